@@ -0,0 +1,428 @@
+#include <chrono>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <random>
+#include "numcpp.hpp"
+
+// numcpp_bench [--filter <substr>] [--min-bytes <n>] [--max-bytes <n>] [--min-time <sec>]
+//              [--out <results.json>] [--compare <baseline.json>] [--threshold <ratio>]
+//
+// Sizes are per-operand footprints from L1-resident (16K) up to 1G; the default sweep stops at 64M,
+// pass --max-bytes 1G for the full range. Byte counts accept K, M and G suffixes.
+
+namespace numcpp::bench {
+    struct options_t {
+        size_t min_bytes = size_t(16) << 10;
+        size_t max_bytes = size_t(64) << 20;
+        float64_t min_time = 0.2;
+        float64_t threshold = 0.1;
+        std::string filter, out_path, compare_path;
+    };
+
+    struct result_t {
+        std::string name, dtype;
+        size_t elements = 0, bytes = 0, iterations = 0;
+        float64_t min_ns = 0, median_ns = 0, mean_ns = 0;
+
+        std::string key() const { return name + '/' + dtype + '/' + std::to_string(bytes); }
+    };
+
+    inline constexpr size_t sizes[] = {size_t(16) << 10, size_t(256) << 10, size_t(8) << 20, size_t(64) << 20, size_t(1) << 30};
+    inline constexpr size_t sort_max_bytes = size_t(8) << 20;
+    inline constexpr size_t print_full_max_bytes = size_t(16) << 10;
+
+    inline volatile size_t sink = 0;
+
+    template <typename T>
+    void consume(const array<T>& arr) noexcept {
+        sink = sink + arr.size();
+    }
+    inline void consume(const std::string& str) noexcept { sink = sink + str.size(); }
+    inline void consume(const bitmask_t& mask) noexcept { sink = sink + mask.size(); }
+    inline void consume(const size_t value) noexcept { sink = sink + value; }
+
+    size_t parse_bytes(const std::string& str) {
+        size_t pos = 0;
+        const size_t value = std::stoull(str, &pos);
+
+        switch (pos < str.size() ? std::toupper(str[pos]) : 0) {
+            case 'G':
+                return value << 30;
+            case 'M':
+                return value << 20;
+            case 'K':
+                return value << 10;
+            default:
+                return value;
+        }
+    }
+
+    std::string format_bytes(const size_t bytes) {
+        if (bytes >= size_t(1) << 30) {
+            return std::to_string(bytes >> 30) + 'G';
+        }
+        if (bytes >= size_t(1) << 20) {
+            return std::to_string(bytes >> 20) + 'M';
+        }
+        return std::to_string(bytes >> 10) + 'K';
+    }
+
+    shape_t bench_shape(const size_t elements) noexcept {
+        const size_t cols = std::min<size_t>(elements, 1024);
+        return {elements / cols, cols};
+    }
+
+    template <typename T>
+    array<T> random_array(const shape_t& shape, std::mt19937_64& gen) {
+        buffer_t<T> buf(shape.size());
+
+        if constexpr (is_floating_point_v<T>) {
+            std::uniform_real_distribution<T> dist(T(-1), T(1));
+            std::generate_n(buf.data(), buf.size, [&] { return dist(gen); });
+        } else {
+            std::uniform_int_distribution<T> dist(T(-1000), T(1000));
+            std::generate_n(buf.data(), buf.size, [&] { return dist(gen); });
+        }
+        return array<T>(std::move(buf), shape);
+    }
+
+    array<ll_t> random_index(const size_t n, const size_t dim, std::mt19937_64& gen) {
+        buffer_t<ll_t> buf(n);
+        std::uniform_int_distribution<ll_t> dist(0, static_cast<ll_t>(dim) - 1);
+        std::generate_n(buf.data(), n, [&] { return dist(gen); });
+        return array<ll_t>(std::move(buf), n);
+    }
+
+    class runner_t {
+        const options_t& options;
+        std::vector<result_t>& results;
+
+    public:
+        runner_t(const options_t& options, std::vector<result_t>& results) noexcept : options(options), results(results) {}
+
+        bool enabled(const std::string& name, const std::string& dtype) const {
+            return options.filter.empty() || (name + '/' + dtype).find(options.filter) != std::string::npos;
+        }
+
+        void measure(const std::string& name, const std::string& dtype, const size_t elements, const size_t bytes, const std::function<void()>& body) {
+            using clock = std::chrono::steady_clock;
+            std::vector<float64_t> samples;
+            float64_t total = 0;
+            body();
+
+            while (total < options.min_time * 1e9 || samples.size() < 3) {
+                const auto start = clock::now();
+                body();
+                const float64_t ns = std::chrono::duration<float64_t, std::nano>(clock::now() - start).count();
+                samples.push_back(ns);
+                total += ns;
+
+                if (total > options.min_time * 1e9 * 10) {
+                    break;
+                }
+            }
+            result_t res{name, dtype, elements, bytes, samples.size()};
+            res.mean_ns = total / samples.size();
+            std::sort(samples.begin(), samples.end());
+            res.min_ns = samples.front();
+            res.median_ns = samples[samples.size() / 2];
+            std::cout << std::left << std::setw(28) << name << std::setw(10) << dtype << std::right << std::setw(6) << format_bytes(bytes)
+                      << std::setw(14) << std::fixed << std::setprecision(3) << res.median_ns / 1e6 << " ms" << std::setw(12)
+                      << res.median_ns / elements << " ns/elem" << std::endl;
+            results.push_back(std::move(res));
+        }
+    };
+
+    template <typename T>
+    void run_suite(runner_t& runner, const std::string& dtype, const options_t& options) {
+        std::mt19937_64 gen(42);
+
+        for (const size_t bytes : sizes) {
+            if (bytes < options.min_bytes || bytes > options.max_bytes) {
+                continue;
+            }
+            const size_t elements = bytes / sizeof(T);
+            const shape_t shape = bench_shape(elements);
+            const array<T> a = random_array<T>(shape, gen), b = random_array<T>(shape, gen);
+            auto bench = [&](const std::string& name, const std::function<void()>& body) {
+                if (runner.enabled(name, dtype)) {
+                    runner.measure(name, dtype, elements, bytes, body);
+                }
+            };
+
+            bench("add/contiguous", [&] { consume(a + b); });
+
+            if (runner.enabled("add/strided", dtype) || runner.enabled("copy/strided", dtype)) {
+                const array<T> wide = random_array<T>({shape.rows(), shape.cols() * 2}, gen);
+                const array<T> lhs = wide[{slice_t(), slice_t(slice_t::none, slice_t::none, 2)}];
+                const array<T> rhs = wide[{slice_t(), slice_t(1, slice_t::none, 2)}];
+                bench("add/strided", [&] { consume(lhs + rhs); });
+                bench("copy/strided", [&] { consume(lhs.copy()); });
+            }
+            bench("copy/contiguous", [&] { consume(a.copy()); });
+            bench("copy/fortran", [&] { consume(asfortranarray(a)); });
+            if (runner.enabled("add/broadcast", dtype)) {
+                const array<T> row = random_array<T>(shape.cols(), gen);
+                bench("add/broadcast", [&] { consume(a + row); });
+            }
+            bench("ufunc/absolute", [&] { consume(absolute(a)); });
+
+            if constexpr (is_floating_point_v<T>) {
+                bench("ufunc/arccos", [&] { consume(arccos(a)); });
+                bench("ufunc/arctan", [&] { consume(arctan(a)); });
+                bench("ufunc/arctan_fast", [&] { consume(arctan(a, none::where, precision_t::fast)); });
+                bench("ufunc/exp", [&] { consume(exp(a)); });
+                bench("ufunc/exp_fast", [&] { consume(exp(a, none::where, precision_t::fast)); });
+                bench("ufunc/sin", [&] { consume(sin(a)); });
+                bench("ufunc/sin_fast", [&] { consume(sin(a, none::where, precision_t::fast)); });
+                bench("ufunc/rad2deg", [&] { consume(rad2deg(a)); });
+                bench("ufunc/around", [&] { consume(around(a, 2)); });
+                bench("ufunc/vectorize", [&] { consume(vectorize([](const T x) { return std::exp(-x * x); })(a)); });
+            }
+            if (runner.enabled("mask/compare", dtype) || runner.enabled("mask/compare_bits", dtype) || runner.enabled("mask/count_bits", dtype)) {
+                const T pivot = a.data()[0];
+                const bitmask_t mask = bitmask_t::less(a, pivot);
+                bench("mask/compare", [&] { consume(a < pivot); });
+                bench("mask/compare_bits", [&] { consume(bitmask_t::less(a, pivot)); });
+                bench("mask/count_bits", [&] { consume(count_nonzero(mask)); });
+            }
+            if (runner.enabled("select/where", dtype) || runner.enabled("select/where_scalar", dtype) || runner.enabled("select/clip", dtype) ||
+                runner.enabled("select/clip_array", dtype)) {
+                const T pivot = a.data()[0];
+                const array<bool> cond = a < pivot;
+                const array<T> high = where(cond, a, b);
+                bench("select/where", [&] { consume(where(cond, a, b)); });
+                bench("select/where_scalar", [&] { consume(where(cond, a, T(0))); });
+                bench("select/clip", [&] { consume(clip(a, std::min(pivot, T(0)), std::max(pivot, T(0)))); });
+                bench("select/clip_array", [&] { consume(clip(a, b, high)); });
+            }
+            if constexpr (is_floating_point_v<T>) {
+                bench("select/nan_to_num", [&] { consume(nan_to_num(a)); });
+            }
+            bench("reduce/all_axis0", [&] { consume(all(a, 0)); });
+            if (runner.enabled("reduce/array_equal", dtype) || runner.enabled("reduce/allclose", dtype)) {
+                const array<T> same = a.copy();
+                bench("reduce/array_equal", [&] { consume(size_t(array_equal(a, same))); });
+                bench("reduce/allclose", [&] { consume(size_t(allclose(a, same))); });
+            }
+            bench("reduce/amax", [&] { consume(amax(a)); });
+            bench("reduce/amax_axis1", [&] { consume(amax(a, 1)); });
+            bench("reduce/amin_axis0", [&] { consume(amin(a, 0)); });
+            bench("reduce/sum", [&] { consume(sum(a)); });
+            bench("reduce/sum_axis0", [&] { consume(sum(a, 0)); });
+            if (runner.enabled("reduce/sum_det", dtype) || runner.enabled("reduce/sum_axis0_det", dtype)) {
+                set_reduction_mode(reduction_mode_t::deterministic);
+                bench("reduce/sum_det", [&] { consume(sum(a)); });
+                bench("reduce/sum_axis0_det", [&] { consume(sum(a, 0)); });
+                set_reduction_mode(reduction_mode_t::fast);
+            }
+            bench("reduce/sum_compensated", [&] { consume(sum(a, none::axis, false, sum_t<T>(0), none::where, summation_t::compensated)); });
+            bench("reduce/mean_axis1", [&] { consume(mean(a, 1)); });
+            bench("reduce/var", [&] { consume(var(a)); });
+            bench("accumulate/cumsum", [&] { consume(cumsum(a)); });
+            bench("accumulate/cumsum_axis0", [&] { consume(cumsum(a, 0)); });
+            bench("accumulate/cummax_axis1", [&] { consume(cummax(a, 1)); });
+            if (runner.enabled("reduce/reduceat", dtype)) {
+                const array<T> flat = a.ravel();
+                std::vector<ll_t> starts;
+
+                for (size_t i = 0; i < elements; i += 32) {
+                    starts.push_back(ll_t(i));
+                }
+                const size_t segments = starts.size();
+                const array<ll_t> indices(std::move(starts), segments);
+                bench("reduce/reduceat", [&] { consume(ufuncs::add.reduceat(flat, indices)); });
+            }
+            bench("reduce/any_axis1", [&] { consume(any(a, 1)); });
+            bench("reduce/argmax_axis1", [&] { consume(argmax(a, 1)); });
+
+            if (bytes <= sort_max_bytes) {
+                bench("sort/argsort", [&] { consume(argsort(a)); });
+                bench("sort/argpartition", [&] { consume(argpartition(a, shape.cols() / 2)); });
+            }
+            if (runner.enabled("index/fancy", dtype)) {
+                const array<ll_t> rows = random_index(elements, shape.rows(), gen), cols = random_index(elements, shape.cols(), gen);
+                bench("index/fancy", [&] { consume(a[{rows, cols}]); });
+            }
+            if (runner.enabled("index/take", dtype) || runner.enabled("index/take_rows", dtype) || runner.enabled("index/scatter_add", dtype)) {
+                const array<ll_t> flat = random_index(elements, elements, gen), rows = random_index(shape.rows(), shape.rows(), gen);
+                array<T> acc = zeros<T>(shape);
+                bench("index/take", [&] { consume(take(a, flat)); });
+                bench("index/take_rows", [&] { consume(take(a, rows, 0)); });
+                bench("index/scatter_add", [&] {
+                    scatter_add(acc, flat, a.ravel());
+                    consume(acc);
+                });
+            }
+            if (runner.enabled("count/histogram", dtype) || runner.enabled("count/histogram_edges", dtype) ||
+                runner.enabled("count/histogram2d", dtype) || runner.enabled("count/bincount", dtype)) {
+                const float64_t span = is_floating_point_v<T> ? 1 : 1000;
+                const array<float64_t> edges = linspace<float64_t>(-span, span, 65);
+                const array<ll_t> values = random_index(elements, 256, gen);
+                bench("count/histogram", [&] { consume(histogram(a, 64, -span, span).first); });
+                bench("count/histogram_edges", [&] { consume(histogram(a, edges)); });
+                bench("count/histogram2d", [&] { consume(std::get<0>(histogram2d(a, b, 64))); });
+                bench("count/bincount", [&] { consume(bincount(values)); });
+            }
+            bench("io/print_summary", [&] {
+                std::ostringstream ss;
+                ss << a;
+                consume(ss.str());
+            });
+
+            if (bytes <= print_full_max_bytes) {
+                bench("io/array2string_full", [&] { consume(array2string(a, 75, 8, false, " ", "", none::size)); });
+            }
+        }
+    }
+
+    std::string json_escape(const std::string& str) {
+        std::string res;
+
+        for (const char c : str) {
+            if (c == '"' || c == '\\') {
+                res += '\\';
+            }
+            res += c;
+        }
+        return res;
+    }
+
+    void write_json(const std::string& path, const std::vector<result_t>& results) {
+        std::ofstream file(path);
+
+        if (!file) {
+            throw std::runtime_error("cannot open " + path + " for writing");
+        }
+        file << "{\n  \"context\": {\"compiler\": \"" << json_escape(__VERSION__) << "\"},\n  \"results\": [\n";
+
+        for (size_t i = 0; i < results.size(); i++) {
+            const result_t& res = results[i];
+            file << "    {\"name\": \"" << json_escape(res.name) << "\", \"dtype\": \"" << res.dtype << "\", \"elements\": " << res.elements
+                 << ", \"bytes\": " << res.bytes << ", \"iterations\": " << res.iterations << std::fixed << std::setprecision(1)
+                 << ", \"min_ns\": " << res.min_ns << ", \"median_ns\": " << res.median_ns << ", \"mean_ns\": " << res.mean_ns << '}'
+                 << (i + 1 < results.size() ? "," : "") << '\n';
+        }
+        file << "  ]\n}\n";
+    }
+
+    // Reads back the flat result objects written by write_json.
+    std::vector<result_t> read_json(const std::string& path) {
+        std::ifstream file(path);
+
+        if (!file) {
+            throw std::runtime_error("cannot open " + path);
+        }
+        const std::string text((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        std::vector<result_t> results;
+        size_t pos = text.find("\"results\"");
+
+        while ((pos = text.find('{', pos)) != std::string::npos) {
+            const size_t end = text.find('}', pos);
+            std::map<std::string, std::string> fields;
+            size_t cur = pos + 1;
+
+            while ((cur = text.find('"', cur)) < end) {
+                const size_t key_end = text.find('"', cur + 1);
+                const std::string key = text.substr(cur + 1, key_end - cur - 1);
+                size_t value_begin = text.find_first_not_of(" :", key_end + 1), value_end;
+
+                if (text[value_begin] == '"') {
+                    value_end = text.find('"', ++value_begin);
+                    cur = value_end + 1;
+                } else {
+                    value_end = text.find_first_of(",}", value_begin);
+                    cur = value_end;
+                }
+                fields[key] = text.substr(value_begin, value_end - value_begin);
+            }
+            result_t res{fields["name"], fields["dtype"]};
+            res.elements = std::stoull(fields["elements"]);
+            res.bytes = std::stoull(fields["bytes"]);
+            res.iterations = std::stoull(fields["iterations"]);
+            res.min_ns = std::stod(fields["min_ns"]);
+            res.median_ns = std::stod(fields["median_ns"]);
+            res.mean_ns = std::stod(fields["mean_ns"]);
+            results.push_back(std::move(res));
+            pos = end;
+        }
+        return results;
+    }
+
+    int compare(const std::vector<result_t>& baseline, const std::vector<result_t>& results, const float64_t threshold) {
+        std::map<std::string, const result_t*> base;
+        size_t regressions = 0;
+
+        for (const result_t& res : baseline) {
+            base[res.key()] = &res;
+        }
+        std::cout << std::defaultfloat << "\ncomparison against baseline (median, threshold " << threshold * 100 << "%)\n";
+
+        for (const result_t& res : results) {
+            const auto it = base.find(res.key());
+
+            if (it == base.end()) {
+                continue;
+            }
+            const float64_t ratio = res.median_ns / it->second->median_ns;
+            const bool regressed = ratio > 1 + threshold;
+            regressions += regressed;
+            std::cout << std::left << std::setw(28) << res.name << std::setw(10) << res.dtype << std::right << std::setw(6) << format_bytes(res.bytes)
+                      << std::setw(10) << std::fixed << std::setprecision(3) << ratio << 'x' << (regressed ? "  REGRESSION" : "") << '\n';
+        }
+        std::cout << regressions << " regression(s)" << std::endl;
+        return regressions ? 1 : 0;
+    }
+} // namespace numcpp::bench
+
+int main(const int argc, char* argv[]) {
+    using namespace numcpp::bench;
+    options_t options;
+
+    try {
+        for (int i = 1; i < argc; i++) {
+            const std::string arg = argv[i];
+
+            if (i + 1 >= argc) {
+                throw std::invalid_argument("missing value for " + arg);
+            }
+            const std::string value = argv[++i];
+
+            if (arg == "--filter") {
+                options.filter = value;
+            } else if (arg == "--min-bytes") {
+                options.min_bytes = parse_bytes(value);
+            } else if (arg == "--max-bytes") {
+                options.max_bytes = parse_bytes(value);
+            } else if (arg == "--min-time") {
+                options.min_time = std::stod(value);
+            } else if (arg == "--out") {
+                options.out_path = value;
+            } else if (arg == "--compare") {
+                options.compare_path = value;
+            } else if (arg == "--threshold") {
+                options.threshold = std::stod(value);
+            } else {
+                throw std::invalid_argument("unknown option " + arg);
+            }
+        }
+        std::vector<result_t> results;
+        runner_t runner(options, results);
+        run_suite<numcpp::float32_t>(runner, "float32", options);
+        run_suite<numcpp::float64_t>(runner, "float64", options);
+        run_suite<numcpp::int32_t>(runner, "int32", options);
+        run_suite<numcpp::int64_t>(runner, "int64", options);
+
+        if (!options.out_path.empty()) {
+            write_json(options.out_path, results);
+        }
+        if (!options.compare_path.empty()) {
+            return compare(read_json(options.compare_path), results, options.threshold);
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "numcpp_bench: " << e.what() << std::endl;
+        return 2;
+    }
+    return 0;
+}
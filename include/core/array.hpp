@@ -3,7 +3,9 @@
 template <typename T>
 class numcpp::array {
     buffer_t<T> buffer = buffer_t<T>();
-    size_t row = 0, col = 0, offset = 0, row_stride = 0, col_stride = 0;
+    shape_t dims = shape_t();
+    strides_t strides = {};
+    size_t offset = 0;
     const void* base = none::base;
     bool is_matrix = false, is_scalar = false, is_assignable = false;
 
@@ -12,21 +14,22 @@ class numcpp::array {
     template <typename, typename>
     class base_iterator;
 
-    array flat_constructor(auto begin, auto end, shape_t shape) {
-        if (shape.cols == none::size) {
-            shape.cols = end - begin;
+    static constexpr bool is_matrix_shape(const shape_t& shape) noexcept { return shape.ndim > 2 || (shape.rows() > 1 && shape.cols() > 1); }
+
+    array flat_constructor(auto begin, auto end, shape_t shape, const order_t order) {
+        if (shape.cols() == none::size) {
+            shape[shape.ndim - 1] = end - begin;
         }
         if (shape.size() != end - begin) {
             throw std::invalid_argument("Size mismatch in flat constructor");
         }
         buffer = buffer_t<T>(shape.size());
         std::copy(begin, end, buffer.data());
-        return array(std::move(buffer), shape, 0, shape.cols, 1, none::base, shape.rows > 1 && shape.cols > 1, false, false);
+        return array(std::move(buffer), shape, contiguous_strides(shape, order), 0, none::base, is_matrix_shape(shape), false, false);
     }
 
     array nested_constructor(const auto& lists) {
-        row = lists.size();
-        col = lists.begin()->size();
+        const size_t row = lists.size(), col = lists.begin()->size();
 
         if (row * col == 0) {
             return array();
@@ -43,13 +46,13 @@ class numcpp::array {
             std::copy(list.begin(), list.end(), buffer.data() + idx);
             idx += col;
         }
-        return array(std::move(buffer), {row, col}, 0, col, 1, none::base, row > 1 && col > 1, false, false);
+        return array(std::move(buffer), {row, col}, {ll_t(col), 1}, 0, none::base, row > 1 && col > 1, false, false);
     }
 
-    array(buffer_t<T> data, const shape_t& shape, const size_t offset, const size_t row_stride, const size_t col_stride, const void* base,
-          const bool is_matrix, const bool is_scalar, const bool is_assignable) noexcept :
-        buffer(std::move(data)), row(shape.rows), col(shape.cols), offset(offset), row_stride(row_stride == none::size ? shape.rows : row_stride),
-        col_stride(col_stride), base(base), is_matrix(is_matrix), is_scalar(is_scalar), is_assignable(is_assignable) {}
+    array(buffer_t<T> data, const shape_t& shape, const strides_t& strides, const size_t offset, const void* base, const bool is_matrix,
+          const bool is_scalar, const bool is_assignable) noexcept :
+        buffer(std::move(data)), dims(shape), strides(strides), offset(offset), base(base), is_matrix(is_matrix), is_scalar(is_scalar),
+        is_assignable(is_assignable) {}
 
 public:
     using iterator = base_iterator<T*, T&>;
@@ -57,149 +60,204 @@ public:
 
     array() noexcept = default;
 
-    array(const array& other) noexcept :
-        array(other.buffer, {other.row, other.col}, other.offset, other.row_stride, other.col_stride, other.base ? other.base : &other,
-              other.is_matrix, other.is_scalar, false) {}
+    array(const array& other) :
+        array(other.buffer, other.dims, other.strides, other.offset, other.base ? other.base : &other, other.is_matrix, other.is_scalar, false) {
+        if (!other.base && detail::copy_on_write.load(std::memory_order_relaxed)) {
+            buffer.share_writes(other.buffer);
+            base = none::base;
+        }
+    }
 
     array(array&& other) noexcept :
-        array(std::move(other.buffer), {other.row, other.col}, other.offset, other.row_stride, other.col_stride, other.base, other.is_matrix,
-              other.is_scalar, other.is_assignable) {
-        other.row = other.col = other.offset = other.row_stride = other.col_stride = 0;
+        array(std::move(other.buffer), other.dims, other.strides, other.offset, other.base, other.is_matrix, other.is_scalar,
+              other.is_assignable) {
+        other.dims = shape_t();
+        other.strides = {};
+        other.offset = 0;
         other.base = none::base;
         other.is_matrix = other.is_scalar = other.is_assignable = false;
     }
 
-    array(std::initializer_list<T> list, const shape_t& shape = none::shape) { *this = flat_constructor(list.begin(), list.end(), shape); }
+    array(std::initializer_list<T> list, const shape_t& shape = none::shape, const order_t order = order_t::C) {
+        *this = flat_constructor(list.begin(), list.end(), shape, order);
+    }
 
-    array(const std::vector<T>& list, const shape_t& shape = none::shape) { *this = flat_constructor(list.begin(), list.end(), shape); }
+    array(const std::vector<T>& list, const shape_t& shape = none::shape, const order_t order = order_t::C) {
+        *this = flat_constructor(list.begin(), list.end(), shape, order);
+    }
 
-    array(std::vector<T>&& list, const shape_t& shape = none::shape) :
-        row(shape.rows), col(shape.cols), row_stride(col), col_stride(1), is_matrix(row > 1 && col > 1) {
-        if (col == none::size) {
-            col = list.size();
+    array(std::vector<T>&& list, shape_t shape = none::shape, const order_t order = order_t::C) {
+        if (shape.cols() == none::size) {
+            shape[shape.ndim - 1] = list.size();
         }
-        if (row * col != list.size()) {
+        if (shape.size() != list.size()) {
             throw std::invalid_argument("Size mismatch in flat move constructor");
         }
-        buffer = buffer_t<T>(std::move(list));
-        std::move(list.begin(), list.end(), buffer.data());
+        if constexpr (std::is_same_v<T, bool>) {
+            *this = flat_constructor(list.begin(), list.end(), shape, order);
+        } else {
+            *this = array(buffer_t<T>(std::move(list)), shape, order);
+        }
     }
 
     array(const std::initializer_list<std::initializer_list<T>>& lists) { *this = nested_constructor(lists); }
 
     array(const std::vector<std::vector<T>>& lists) { *this = nested_constructor(lists); }
 
-    array(std::vector<std::vector<T>>&& lists) :
-        row(lists.size()), col(lists.empty() ? 0 : lists.front().size()), row_stride(col), col_stride(1), is_matrix(row > 1 && col > 1) {
-        for (std::vector<T>& list : lists) {
-            if (list.size() != col) {
-                throw std::invalid_argument("Inconsistent inner vector sizes");
-            }
-        }
-        if (row * col == 0) {
-            buffer.reset();
-        } else {
-            buffer = buffer_t<T>(row * col);
-            size_t index = 0;
+    array(std::vector<std::vector<T>>&& lists) {
+        array_builder<T> builder(lists.empty() ? 0 : lists.front().size());
+        builder.reserve(lists.size());
 
-            for (std::vector<T>& list : lists) {
-                std::move(list.begin(), list.end(), buffer.data() + index);
-                index += col;
-            }
+        for (std::vector<T>& list : lists) {
+            builder.push_row(std::move(list));
         }
+        *this = builder.finish();
     }
 
-    array(const buffer_t<T>& buf, const shape_t& shape, const bool copy = true) :
-        row(shape.rows), col(shape.cols), row_stride(col), col_stride(1), is_matrix(row > 1 && col > 1) {
+    array(const buffer_t<T>& buf, const shape_t& shape, const bool copy = true, const order_t order = order_t::C) :
+        dims(shape), strides(contiguous_strides(shape, order)), is_matrix(is_matrix_shape(shape)) {
         if (copy) {
-            buffer = buffer_t<T>(row * col);
-            std::copy_n(buf.data(), buffer.size, buffer.data());
+            buffer = buffer_t<T>(buf.data(), shape.size());
         } else {
             buffer = buf;
         }
     }
 
-    array(buffer_t<T>&& buf, const shape_t& shape) : array(buf, shape, false) {}
+    array(buffer_t<T>&& buf, const shape_t& shape, const order_t order = order_t::C) noexcept :
+        buffer(std::move(buf)), dims(shape), strides(contiguous_strides(shape, order)), is_matrix(is_matrix_shape(shape)) {}
+
+    array(const T* list, const shape_t& shape, const bool copy = true, const order_t order = order_t::C) :
+        array(copy ? buffer_t<T>(const_cast<T*>(list), shape.size()) : buffer_t<T>(const_cast<T*>(list), shape.size(), nullptr), shape, order) {}
 
-    array(const T* list, const shape_t& shape, const bool copy = true) :
-        array(copy ? buffer_t<T>(const_cast<T*>(list), shape.size()) : buffer_t<T>(const_cast<T*>(list), shape.size(), nullptr), shape) {}
+    array(std::unique_ptr<T[]>&& data, const shape_t& shape, const order_t order = order_t::C) :
+        array(buffer_t<T>(std::move(data), shape.size()), shape, order) {}
+
+    template <typename Deleter>
+    requires(std::is_invocable_v<Deleter&, T*>)
+    array(T* data, const shape_t& shape, Deleter deleter, const order_t order = order_t::C) :
+        array(buffer_t<T>(data, shape.size(), std::move(deleter)), shape, order) {}
 
     array(const T& value) : array(&value, {1, 1}) { is_scalar = true; }
 
-    size_t ndim() const noexcept { return row > 1 && col > 1 ? 2 : 1; }
+    size_t ndim() const noexcept { return dims.ndim > 2 ? dims.ndim : dims.rows() > 1 && dims.cols() > 1 ? 2 : 1; }
 
-    size_t size() const noexcept { return row * col; }
+    size_t size() const noexcept { return dims.size(); }
 
-    array<real_t<T>> real() noexcept requires(is_numeric_v<T>)
+    T* data() {
+        buffer.detach();
+        return buffer.data() + offset;
+    }
+    const T* data() const noexcept { return buffer.data() + offset; }
+
+    array<real_t<T>> real() requires(is_numeric_v<T>)
     {
         using V = real_t<T>;
+        buffer.detach();
 
         if constexpr (is_complex_v<T>) {
-            return array<V>(buffer_t<V>(reinterpret_cast<V*>(buffer.data()), size() * 2, nullptr), {row, col}, offset * 2, row_stride * 2,
-                            col_stride * 2, this, is_matrix, row == 1 && col == 1, true);
+            strides_t res_strides = strides;
+
+            for (ll_t& stride : res_strides) {
+                stride *= 2;
+            }
+            return array<V>(buffer.template alias_as<V>(buffer.size * 2), dims, res_strides, offset * 2, this,
+                            is_matrix, is_scalar, true);
         } else {
-            array res = *this;
-            res.is_assignable = true;
-            return res;
+            return array(buffer, dims, strides, offset, this, is_matrix, is_scalar, true);
         }
     }
 
-    array<real_t<T>> imag() noexcept requires(is_numeric_v<T>)
+    array<real_t<T>> imag() requires(is_numeric_v<T>)
     {
         using V = real_t<T>;
+        buffer.detach();
 
         if constexpr (is_complex_v<T>) {
-            return array<V>(buffer_t<V>(reinterpret_cast<V*>(buffer.data()), size() * 2, nullptr), {row, col}, offset * 2 + 1, row_stride * 2,
-                            col_stride * 2, this, is_matrix, row == 1 && col == 1, true);
+            strides_t res_strides = strides;
+
+            for (ll_t& stride : res_strides) {
+                stride *= 2;
+            }
+            return array<V>(buffer.template alias_as<V>(buffer.size * 2), dims, res_strides, offset * 2 + 1, this,
+                            is_matrix, is_scalar, true);
         } else {
             return zeros<V>(shape());
         }
     }
 
-    shape_t shape() const noexcept { return {row, col}; }
+    shape_t shape() const noexcept { return dims; }
 
+    // Views may be written through, so a copy-on-write owner that shares its storage detaches before handing one out, const or not.
     array operator[](const index_t&) const;
 
+    bool owns_data() const noexcept { return base == none::base; }
+
     array& operator=(const array& other) {
+        if (other.is_scalar || is_assignable) {
+            buffer.detach();
+        }
         if (other.is_scalar) {
             buffer[offset] = other;
         }
         if (is_assignable) {
-            const shape_t lhs_shape = shape(), rhs_shape = other.shape();
-            const shape_t res_shape = broadcast_shape(lhs_shape, rhs_shape);
+            const shape_t rhs_shape = other.shape();
 
-            if (lhs_shape != res_shape) {
+            if (dims != broadcast_shape(dims, rhs_shape)) {
                 throw std::runtime_error("Broadcasted shape doesn't match array shape.");
             }
-            size_t k = 0;
-
-            for (ll_t i = 0; i < row; i++) {
-                for (ll_t j = 0; j < col; j++) {
-                    buffer[k++] = other[broadcast_index({i, j}, rhs_shape)];
-                }
-            }
+            T* dst = data();
+            const T* src = other.data();
+            detail::strided_loop<2>(dims, {strides, detail::broadcast_strides(rhs_shape, other.strides, dims)},
+                                    [&](const auto& pos, const size_t n, const auto& step) {
+                                        for (size_t k = 0; k < n; k++) {
+                                            dst[pos[0] + ll_t(k) * step[0]] = src[pos[1] + ll_t(k) * step[1]];
+                                        }
+                                    });
         } else if (this != &other) {
             buffer = other.buffer;
-            row = other.row;
-            col = other.col;
+            dims = other.dims;
+            strides = other.strides;
             offset = other.offset;
-            row_stride = other.row_stride;
-            col_stride = other.col_stride;
             base = other.base;
             is_scalar = other.is_scalar;
             is_matrix = other.is_matrix;
+
+            if (!base && detail::copy_on_write.load(std::memory_order_relaxed)) {
+                buffer.share_writes(other.buffer);
+            }
         }
         is_assignable = false;
         return *this;
     }
 
+    array& operator=(array&& other) {
+        if (is_assignable || other.is_scalar) {
+            return *this = static_cast<const array&>(other);
+        }
+        if (this != &other) {
+            buffer = std::move(other.buffer);
+            dims = other.dims;
+            strides = other.strides;
+            offset = other.offset;
+            base = other.base;
+            is_scalar = other.is_scalar;
+            is_matrix = other.is_matrix;
+        }
+        return *this;
+    }
+
     array& operator=(const T& other) {
+        buffer.detach();
+
         if (is_scalar) {
             buffer[offset] = other;
         } else if (is_assignable) {
-            for (ll_t i = 0; i < row * col; i++) {
-                buffer[i] = other;
-            }
+            T* dst = data();
+            detail::strided_loop<1>(dims, {strides}, [&](const auto& pos, const size_t n, const auto& step) {
+                for (size_t k = 0; k < n; k++) {
+                    dst[pos[0] + ll_t(k) * step[0]] = other;
+                }
+            });
         } else {
             throw std::invalid_argument("Illegal assignment of a scalar to a non-scalar array.");
         }
@@ -216,27 +274,50 @@ public:
         }
         throw std::invalid_argument("illegal scalar conversion of an array");
     }
-    constexpr operator T&() noexcept { return const_cast<T&>(static_cast<const T&>(static_cast<const array&>(*this))); }
+    constexpr operator T&() {
+        buffer.detach();
+        return const_cast<T&>(static_cast<const T&>(static_cast<const array&>(*this)));
+    }
     constexpr operator bool() const noexcept requires(!std::is_same_v<T, bool>)
     {
         return static_cast<T>(*this);
     }
 
-    array reshape(const shape_t& shape) const {
+    array reshape(const shape_t& shape, const order_t order = order_t::C) const {
         if (shape.size() != size()) {
             throw std::invalid_argument("reshape size mismatch");
         }
-        if (row_stride != col || col_stride != 1) {
-            throw std::runtime_error("cannot reshape a non-contiguous array");
+        strides_t res_strides;
+
+        if (size() == 0 || detail::reshape_strides(dims, strides, shape, order, res_strides)) {
+            buffer.detach();
+            return array(buffer, shape, size() ? res_strides : contiguous_strides(shape, order), offset, base ? base : this, is_matrix_shape(shape),
+                         false, false);
         }
-        return array(buffer, shape, offset, shape.cols, 1, base ? base : this, shape.rows > 1 && shape.cols > 1, false, false);
+        return copy(order).reshape(shape, order);
     }
 
-    array copy() const noexcept { return array(buffer, shape()); }
+    array ravel(const order_t order = order_t::C) const { return reshape(size(), order); }
+
+    array copy(const order_t order = order_t::C) const {
+        array res(buffer_t<T>(size()), dims, order);
+        detail::strided_copy(dims, res.data(), res.strides, data(), strides);
+        return res;
+    }
+
+    array& copy_to(array& out) const {
+        if (out.dims != dims) {
+            throw std::invalid_argument("Shape mis-match with out and expected out-put");
+        }
+        detail::strided_copy(dims, out.data(), out.strides, data(), strides);
+        return out;
+    }
 
     template <typename V>
     friend constexpr size_t offset(const array<V>&) noexcept;
     template <typename V>
+    friend constexpr strides_t strides(const array<V>&) noexcept;
+    template <typename V>
     friend constexpr buffer_t<V> buffer(const array<V>&) noexcept;
     template <typename V>
     friend constexpr const void* base(const array<V>&) noexcept;
@@ -247,10 +328,10 @@ public:
     template <typename V>
     friend constexpr bool is_assignable(const array<V>&) noexcept;
 
-    iterator begin() noexcept { return iterator(buffer.data() + offset, row, col, row_stride, col_stride, 0); }
-    iterator end() noexcept { return iterator(buffer.data() + offset, row, col, row_stride, col_stride, row * col); }
-    const_iterator begin() const noexcept { return const_iterator(buffer.data() + offset, row, col, row_stride, col_stride, 0); }
-    const_iterator end() const noexcept { return const_iterator(buffer.data() + offset, row, col, row_stride, col_stride, row * col); }
+    iterator begin() { return iterator(data(), dims, strides, 0); }
+    iterator end() { return iterator(data(), dims, strides, size()); }
+    const_iterator begin() const noexcept { return const_iterator(data(), dims, strides, 0); }
+    const_iterator end() const noexcept { return const_iterator(data(), dims, strides, size()); }
 };
 
 template <typename T>
@@ -266,19 +347,31 @@ public:
 private:
     pointer ptr;
     difference_type index = 0;
-    difference_type rows, cols, row_stride, col_stride;
+    shape_t dims;
+    strides_t strides;
+    bool contiguous;
+
+    constexpr pointer compute() const noexcept {
+        if (contiguous) {
+            return ptr + index;
+        }
+        difference_type rest = index, res = 0;
 
-    constexpr pointer compute() const noexcept { return ptr + index / cols * row_stride + index % cols * col_stride; }
+        for (size_t d = dims.ndim; d-- > 0;) {
+            res += rest % difference_type(dims[d]) * strides[d];
+            rest /= difference_type(dims[d]);
+        }
+        return ptr + res;
+    }
 
 public:
-    constexpr explicit base_iterator(const pointer base_ptr, const difference_type rows, const difference_type cols, const difference_type row_stride,
-                                     const difference_type col_stride, const difference_type start_index = 0) noexcept :
-        ptr(base_ptr), index(start_index), rows(rows), cols(cols), row_stride(row_stride), col_stride(col_stride) {}
+    constexpr explicit base_iterator(const pointer base_ptr, const shape_t& dims, const strides_t& strides,
+                                     const difference_type start_index = 0) noexcept :
+        ptr(base_ptr), index(start_index), dims(dims), strides(strides), contiguous(is_contiguous(dims, strides)) {}
 
     template <typename P, typename R>
     constexpr base_iterator(const base_iterator<P, R>& other) noexcept :
-        ptr(other.ptr), index(other.index), rows(other.rows), cols(other.cols), row_stride(other.row_stride), col_stride(other.col_stride) {}
-
+        ptr(other.ptr), index(other.index), dims(other.dims), strides(other.strides), contiguous(other.contiguous) {}
 
     constexpr reference operator*() const noexcept { return *compute(); }
     constexpr pointer operator->() const noexcept { return compute(); }
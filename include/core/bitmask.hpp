@@ -0,0 +1,235 @@
+#pragma once
+#include "../libs/indexing.hpp"
+
+namespace numcpp::detail {
+    // Reads element i of a bitmask_t as a bool, so kernels index bit masks as they index `const bool*` ones.
+    struct bit_reader_t {
+        const uint64_t* words = nullptr;
+        ll_t offset = 0;
+
+        constexpr bool operator[](const ll_t i) const noexcept { return (words[(offset + i) >> 6] >> ((offset + i) & 63)) & 1; }
+        constexpr bit_reader_t operator+(const ll_t n) const noexcept { return {words, offset + n}; }
+        constexpr explicit operator bool() const noexcept { return words != nullptr; }
+    };
+
+    // Packs 64 bools into a word, bit j from bytes[j]: the multiply gathers the low bit of each of eight bytes into the top byte.
+    inline uint64_t pack_word(const uint8_t* bytes) noexcept {
+        uint64_t word = 0;
+
+        for (size_t i = 0; i < 8; i++) {
+            uint64_t chunk;
+            std::memcpy(&chunk, bytes + 8 * i, 8);
+            word |= ((chunk * 0x0102040810204080) >> 56) << (8 * i);
+        }
+        return word;
+    }
+} // namespace numcpp::detail
+
+// Boolean array packed 64 elements to a word in C order, the bits past size() left zero. Comparisons emit words directly, count, all and
+// any work a word at a time and it is accepted wherever a where_t mask is, at an eighth of the memory of array<bool>.
+class numcpp::bitmask_t {
+    buffer_t<uint64_t> buffer = buffer_t<uint64_t>();
+    shape_t dims = shape_t();
+
+    uint64_t tail_mask() const noexcept {
+        const size_t rem = size() % 64;
+        return rem ? (uint64_t(1) << rem) - 1 : ~uint64_t(0);
+    }
+
+    template <typename Op>
+    bitmask_t combine(const bitmask_t& other, Op op) const {
+        if (dims != other.dims) {
+            throw std::invalid_argument("Shape mis-match between bitmasks");
+        }
+        bitmask_t res(dims);
+        uint64_t* dst = res.buffer.data();
+        const uint64_t *lhs = buffer.data(), *rhs = other.buffer.data();
+
+        for (size_t i = 0; i < buffer.size; i++) {
+            dst[i] = op(lhs[i], rhs[i]);
+        }
+        return res;
+    }
+
+    // Sets bit i of the C-ordered broadcast of lhs and rhs to op(lhs, rhs). Whole words are compared into a block of bytes, a loop that
+    // vectorizes like any comparison, and then packed by pack_word.
+    template <typename L, typename R, typename Op>
+    static bitmask_t compare(const detail::operand_t<L>& lhs, const detail::operand_t<R>& rhs, Op op) {
+        const shape_t shape = broadcast_shape(lhs.shape, rhs.shape);
+        bitmask_t res(shape);
+        uint64_t* words = res.buffer.data();
+
+        detail::strided_loop<3>(shape,
+                                {contiguous_strides(shape), detail::broadcast_strides(lhs.shape, lhs.strides, shape),
+                                 detail::broadcast_strides(rhs.shape, rhs.strides, shape)},
+                                [&](const auto& pos, const size_t n, const auto& step) {
+                                    const size_t first = size_t(pos[0]), head = std::min(n, (64 - first % 64) % 64);
+                                    const L* l = lhs.data + pos[1];
+                                    const R* r = rhs.data + pos[2];
+                                    const ll_t l_step = step[1], r_step = step[2];
+                                    auto fill = [&](auto test) {
+                                        size_t k = 0;
+
+                                        for (; k < head; k++) {
+                                            words[(first + k) / 64] |= uint64_t(test(k)) << ((first + k) % 64);
+                                        }
+                                        for (; k + 64 <= n; k += 64) {
+                                            uint8_t bytes[64];
+
+#pragma GCC unroll 1
+                                            for (size_t j = 0; j < 64; j++) {
+                                                bytes[j] = test(k + j);
+                                            }
+                                            words[(first + k) / 64] = detail::pack_word(bytes);
+                                        }
+                                        for (; k < n; k++) {
+                                            words[(first + k) / 64] |= uint64_t(test(k)) << ((first + k) % 64);
+                                        }
+                                    };
+
+                                    // A broadcast scalar side is loaded once, as in binary_opr_element_wise.
+                                    if (r_step == 0) {
+                                        const R value = *r;
+                                        fill([&](const size_t k) -> uint8_t { return op(l[ll_t(k) * l_step], value); });
+                                    } else if (l_step == 0) {
+                                        const L value = *l;
+                                        fill([&](const size_t k) -> uint8_t { return op(value, r[ll_t(k) * r_step]); });
+                                    } else {
+                                        fill([&](const size_t k) -> uint8_t { return op(l[ll_t(k) * l_step], r[ll_t(k) * r_step]); });
+                                    }
+                                });
+        return res;
+    }
+
+public:
+    bitmask_t() noexcept = default;
+
+    explicit bitmask_t(const shape_t& shape, const bool value = false) : buffer((shape.size() + 63) / 64), dims(shape) {
+        if (value) {
+            std::fill_n(buffer.data(), buffer.size, ~uint64_t(0));
+
+            if (buffer.size) {
+                buffer.data()[buffer.size - 1] &= tail_mask();
+            }
+        }
+    }
+
+    template <typename T>
+    explicit bitmask_t(const array<T>& arr) : bitmask_t(compare(detail::as_operand(arr), detail::as_operand(T()), std::not_equal_to())) {}
+
+    // op(lhs, rhs) elementwise as bits, each side an array or a scalar broadcast against the other.
+    template <typename L, typename R, typename Op>
+    static bitmask_t compare(const L& lhs, const R& rhs, Op op) {
+        return compare(detail::as_operand(lhs), detail::as_operand(rhs), op);
+    }
+    template <typename L, typename R>
+    static bitmask_t equal(const L& lhs, const R& rhs) {
+        return compare(lhs, rhs, std::equal_to());
+    }
+    template <typename L, typename R>
+    static bitmask_t not_equal(const L& lhs, const R& rhs) {
+        return compare(lhs, rhs, std::not_equal_to());
+    }
+    template <typename L, typename R>
+    static bitmask_t less(const L& lhs, const R& rhs) {
+        return compare(lhs, rhs, std::less());
+    }
+    template <typename L, typename R>
+    static bitmask_t less_equal(const L& lhs, const R& rhs) {
+        return compare(lhs, rhs, std::less_equal());
+    }
+    template <typename L, typename R>
+    static bitmask_t greater(const L& lhs, const R& rhs) {
+        return compare(lhs, rhs, std::greater());
+    }
+    template <typename L, typename R>
+    static bitmask_t greater_equal(const L& lhs, const R& rhs) {
+        return compare(lhs, rhs, std::greater_equal());
+    }
+
+    shape_t shape() const noexcept { return dims; }
+
+    size_t size() const noexcept { return dims.size(); }
+
+    const uint64_t* words() const noexcept { return buffer.data(); }
+
+    size_t num_words() const noexcept { return buffer.size; }
+
+    bool operator[](const size_t i) const noexcept { return (buffer.data()[i / 64] >> (i % 64)) & 1; }
+
+    size_t count() const noexcept {
+        const uint64_t* ptr = buffer.data();
+        size_t res = 0;
+
+        for (size_t i = 0; i < buffer.size; i++) {
+            res += std::popcount(ptr[i]);
+        }
+        return res;
+    }
+
+    bool all() const noexcept {
+        const uint64_t* ptr = buffer.data();
+
+        for (size_t i = 0; i + 1 < buffer.size; i++) {
+            if (ptr[i] != ~uint64_t(0)) {
+                return false;
+            }
+        }
+        return buffer.size == 0 || ptr[buffer.size - 1] == tail_mask();
+    }
+
+    bool any() const noexcept {
+        const uint64_t* ptr = buffer.data();
+
+        for (size_t i = 0; i < buffer.size; i++) {
+            if (ptr[i]) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    array<bool> to_array() const {
+        array<bool> res(buffer_t<bool>(size()), dims);
+        bool* dst = res.data();
+        const detail::bit_reader_t bits = {buffer.data()};
+
+        for (size_t i = 0; i < size(); i++) {
+            dst[i] = bits[ll_t(i)];
+        }
+        return res;
+    }
+
+    bitmask_t operator~() const {
+        bitmask_t res = combine(*this, [](const uint64_t word, uint64_t) { return ~word; });
+
+        if (res.buffer.size) {
+            res.buffer.data()[res.buffer.size - 1] &= tail_mask();
+        }
+        return res;
+    }
+    bitmask_t operator&(const bitmask_t& other) const { return combine(other, std::bit_and()); }
+    bitmask_t operator|(const bitmask_t& other) const { return combine(other, std::bit_or()); }
+    bitmask_t operator^(const bitmask_t& other) const { return combine(other, std::bit_xor()); }
+
+    bitmask_t& operator&=(const bitmask_t& other) { return *this = *this & other; }
+    bitmask_t& operator|=(const bitmask_t& other) { return *this = *this | other; }
+    bitmask_t& operator^=(const bitmask_t& other) { return *this = *this ^ other; }
+};
+
+namespace numcpp {
+    template <typename T>
+    constexpr strides_t strides(const array<T>&) noexcept;
+
+    inline shape_t where_t::shape() const noexcept { return bits ? bits->shape() : ptr->shape(); }
+
+    inline strides_t where_t::strides() const noexcept { return bits ? contiguous_strides(bits->shape()) : numcpp::strides(*ptr); }
+
+    template <typename Visitor>
+    decltype(auto) where_t::visit(Visitor visitor) const {
+        if (bits) {
+            return visitor(detail::bit_reader_t{bits->words()});
+        }
+        return visitor(ptr->data());
+    }
+} // namespace numcpp
@@ -0,0 +1,85 @@
+#pragma once
+
+template <typename T>
+class numcpp::array_builder {
+    buffer_t<T> buffer = buffer_t<T>();
+    size_t rows = 0, cols = 0, capacity = 0;
+
+    void grow(const size_t min_rows) {
+        if (min_rows <= capacity) {
+            return;
+        }
+        const size_t new_capacity = std::max({min_rows, capacity * 2, size_t(1)});
+        buffer_t<T> buf(new_capacity * cols);
+        std::move(buffer.data(), buffer.data() + rows * cols, buf.data());
+        buffer = std::move(buf);
+        capacity = new_capacity;
+    }
+
+public:
+    explicit array_builder(const size_t cols) noexcept : cols(cols) {}
+
+    void reserve(const size_t n_rows) { grow(n_rows); }
+
+    template <typename It>
+    void push_row(It first, It last) {
+        if (static_cast<size_t>(std::distance(first, last)) != cols) {
+            throw std::invalid_argument("row size mis-match with builder columns");
+        }
+        grow(rows + 1);
+        std::copy(first, last, buffer.data() + rows * cols);
+        rows++;
+    }
+    void push_row(std::initializer_list<T> row) { push_row(row.begin(), row.end()); }
+    void push_row(const std::vector<T>& row) { push_row(row.begin(), row.end()); }
+    void push_row(std::vector<T>&& row) { push_row(std::make_move_iterator(row.begin()), std::make_move_iterator(row.end())); }
+    void push_row(const array<T>& row) {
+        if (row.size() != cols) {
+            throw std::invalid_argument("row size mis-match with builder columns");
+        }
+        push_row(row.begin(), row.end());
+    }
+
+    void push_rows(const T* data, const size_t n_rows) {
+        grow(rows + n_rows);
+        std::copy_n(data, n_rows * cols, buffer.data() + rows * cols);
+        rows += n_rows;
+    }
+    void push_rows(const array<T>& arr) {
+        const shape_t arr_shape = arr.shape();
+
+        if (arr_shape.ndim > 2) {
+            throw std::invalid_argument("rows must be pushed from an array of at most two dimensions");
+        }
+        if (arr_shape.cols() != cols) {
+            throw std::invalid_argument("dimension of rows mis-match with builder columns");
+        }
+        grow(rows + arr_shape.rows());
+        std::copy(arr.begin(), arr.end(), buffer.data() + rows * cols);
+        rows += arr_shape.rows();
+    }
+
+    // Releases the capacity beyond the rows pushed so far, at the cost of one copy of them. finish() itself never copies.
+    void shrink_to_fit() {
+        if (capacity == rows) {
+            return;
+        }
+        buffer_t<T> buf(rows * cols);
+        std::move(buffer.data(), buffer.data() + rows * cols, buf.data());
+        buffer = std::move(buf);
+        capacity = rows;
+    }
+
+    // The rows pushed so far as a (rows, cols) array, which takes the storage as it is and leaves the builder empty.
+    array<T> finish() {
+        const shape_t res_shape(rows, cols);
+        buffer_t<T> buf = std::move(buffer);
+        buf.size = res_shape.size();
+        buffer = buffer_t<T>();
+        rows = capacity = 0;
+        return array<T>(std::move(buf), res_shape);
+    }
+
+    shape_t shape() const noexcept { return {rows, cols}; }
+    size_t size() const noexcept { return rows * cols; }
+};
@@ -22,7 +22,7 @@ namespace numcpp {
                 return format_options.nanstr;
             }
             if (std::isinf(value)) {
-                return (value < 0 ? '-' : format_options.sign != '-' ? char() : format_options.sign) + format_options.infstr;
+                return (value < 0 ? "-" : format_options.sign != '-' ? std::string(1, format_options.sign) : "") + format_options.infstr;
             }
             std::ostringstream ss;
 
@@ -46,15 +46,17 @@ namespace numcpp {
                 res[0] = ' ';
             }
             if (format_options.floatmode == "maxprec") {
-                const auto dot_pos = res.find('.');
+                const auto dot_pos = res.find('.'), e_pos = std::min(res.find('e'), res.size());
 
                 if (dot_pos != std::string::npos) {
-                    size_t end = res.size();
+                    size_t end = e_pos;
 
                     while (end > dot_pos + 1 && res[end - 1] == '0') {
                         --end;
                     }
-                    res.resize(end);
+                    res.erase(end, e_pos - end);
+                } else {
+                    res.insert(e_pos, 1, '.');
                 }
             } else if (format_options.floatmode == "scientific") {
                 const auto dot_pos = res.find('.'), e_pos = res.find('e');
@@ -83,6 +85,35 @@ namespace numcpp {
 
     template <typename T>
     std::ostream& operator<<(std::ostream& out, const array<T>& other) {
+        const shape_t shape = other.shape();
+
+        if (shape.ndim > 2) {
+            const bool truncate = format_options.threshold < shape.size() && format_options.edgeitems * 2 < shape[0];
+            const std::string separator = std::string(shape.ndim - 1, '\n') + ' ';
+            out << '[';
+
+            for (ll_t i = 0; i < ll_t(shape[0]); i++) {
+                if (i > 0) {
+                    out << separator;
+                }
+                if (truncate && i == ll_t(format_options.edgeitems)) {
+                    out << "..." << separator;
+                    i = shape[0] - format_options.edgeitems;
+                }
+                std::stringstream ss;
+                ss << other[i];
+                const std::string block = ss.str();
+
+                for (size_t j = 0; j < block.size(); j++) {
+                    out << block[j];
+
+                    if (block[j] == '\n' && j + 1 < block.size() && block[j + 1] != '\n') {
+                        out << ' ';
+                    }
+                }
+            }
+            return out << ']' << std::flush;
+        }
         print_options temp = format_options;
 
         if (!format_options.suppress) {
@@ -108,7 +139,7 @@ namespace numcpp {
         } else {
             format_options.floatmode = "maxprec";
         }
-        auto [row, col] = other.shape();
+        const size_t row = shape.rows(), col = shape.cols();
         auto will_truncate = [&](const size_t limit) -> bool { return format_options.threshold < row * col && format_options.edgeitems * 2 < limit; };
         const bool is_col_vector = (col == 1);
         const size_t width_dim = is_col_vector ? row : col;
@@ -127,7 +158,7 @@ namespace numcpp {
                 if (will_truncate(col) && j == format_options.edgeitems) {
                     j = col - format_options.edgeitems - (format_options.edgeitems ? 0 : 1);
                 }
-                const std::string s = format(static_cast<T>(other[{i, j}]));
+                const std::string s = format(static_cast<const T&>(other[{i, j}]));
 
                 if constexpr (is_floating_point_v<T>) {
                     if (!s.contains('n')) { // nan // inf
@@ -206,7 +237,7 @@ namespace numcpp {
                     write_with_wrap("..." + format_options.seperator);
                     j = col - format_options.edgeitems - (format_options.edgeitems ? 0 : 1);
                 }
-                const std::string s = format(static_cast<T>(other[{i, j}]));
+                const std::string s = format(static_cast<const T&>(other[{i, j}]));
 
                 if constexpr (is_floating_point_v<T>) {
                     if (!s.contains('n')) { // nan // inf
@@ -249,9 +280,15 @@ namespace numcpp {
         }
         if (!is_scalar(other)) {
             ss << "]";
-            write_with_wrap(ss.str());
         }
+        write_with_wrap(ss.str());
         format_options = temp;
         return out << std::flush;
     }
+
+    template <typename G>
+    requires(is_lazy_v<G>)
+    std::ostream& operator<<(std::ostream& out, const G& gen) {
+        return out << static_cast<array<typename G::value_type>>(gen);
+    }
 } // namespace numcpp
@@ -292,4 +292,195 @@ namespace numcpp {
         binary_opr_element_wise(lhs, value, std::bit_xor(), operations::in_place_t());
         return lhs;
     }
+
+    template <typename G, typename R>
+    requires(is_lazy_v<G> && is_numeric_v<R>)
+    array<promote_t<typename G::value_type, R>> operator+(const G& gen, const R& value) {
+        return binary_opr_element_wise(gen, value, std::plus());
+    }
+    template <typename L, typename G>
+    requires(is_lazy_v<G> && is_numeric_v<L>)
+    array<promote_t<L, typename G::value_type>> operator+(const L& value, const G& gen) {
+        return binary_opr_element_wise(gen, value, std::plus(), operations::swap_t());
+    }
+
+    template <typename G, typename R>
+    requires(is_lazy_v<G> && is_numeric_v<R>)
+    array<promote_t<typename G::value_type, R>> operator-(const G& gen, const R& value) {
+        return binary_opr_element_wise(gen, value, std::minus());
+    }
+    template <typename L, typename G>
+    requires(is_lazy_v<G> && is_numeric_v<L>)
+    array<promote_t<L, typename G::value_type>> operator-(const L& value, const G& gen) {
+        return binary_opr_element_wise(gen, value, std::minus(), operations::swap_t());
+    }
+
+    template <typename G, typename R>
+    requires(is_lazy_v<G> && is_numeric_v<R>)
+    array<promote_t<typename G::value_type, R>> operator*(const G& gen, const R& value) {
+        return binary_opr_element_wise(gen, value, std::multiplies());
+    }
+    template <typename L, typename G>
+    requires(is_lazy_v<G> && is_numeric_v<L>)
+    array<promote_t<L, typename G::value_type>> operator*(const L& value, const G& gen) {
+        return binary_opr_element_wise(gen, value, std::multiplies(), operations::swap_t());
+    }
+
+    template <typename G, typename R>
+    requires(is_lazy_v<G> && is_numeric_v<R>)
+    array<promote_t<typename G::value_type, R>> operator/(const G& gen, const R& value) {
+        return binary_opr_element_wise(gen, value, detail::divides());
+    }
+    template <typename L, typename G>
+    requires(is_lazy_v<G> && is_numeric_v<L>)
+    array<promote_t<L, typename G::value_type>> operator/(const L& value, const G& gen) {
+        return binary_opr_element_wise(gen, value, detail::divides(), operations::swap_t());
+    }
+
+    template <typename G, typename R>
+    requires(is_lazy_v<G> && is_numeric_v<R>)
+    array<bool> operator==(const G& gen, const R& value) {
+        return binary_opr_element_wise(gen, value, std::equal_to(), operations::comparison_t());
+    }
+
+    template <typename G, typename R>
+    requires(is_lazy_v<G> && is_numeric_v<R>)
+    array<bool> operator!=(const G& gen, const R& value) {
+        return binary_opr_element_wise(gen, value, std::not_equal_to(), operations::comparison_t());
+    }
+
+    template <typename G, typename R>
+    requires(is_lazy_v<G> && is_numeric_v<R>)
+    array<bool> operator>(const G& gen, const R& value) {
+        return binary_opr_element_wise(gen, value, std::greater(), operations::comparison_t());
+    }
+
+    template <typename G, typename R>
+    requires(is_lazy_v<G> && is_numeric_v<R>)
+    array<bool> operator>=(const G& gen, const R& value) {
+        return binary_opr_element_wise(gen, value, std::greater_equal(), operations::comparison_t());
+    }
+
+    template <typename G, typename R>
+    requires(is_lazy_v<G> && is_numeric_v<R>)
+    array<bool> operator<(const G& gen, const R& value) {
+        return binary_opr_element_wise(gen, value, std::less(), operations::comparison_t());
+    }
+
+    template <typename G, typename R>
+    requires(is_lazy_v<G> && is_numeric_v<R>)
+    array<bool> operator<=(const G& gen, const R& value) {
+        return binary_opr_element_wise(gen, value, std::less_equal(), operations::comparison_t());
+    }
+
+    // A generator against an array broadcasts like an array of its elements, which are computed as they are read.
+    template <typename G, typename R>
+    requires(is_lazy_v<G>)
+    array<promote_t<typename G::value_type, R>> operator+(const G& gen, const array<R>& rhs) {
+        return binary_opr_broadcast(gen, rhs, std::plus());
+    }
+    template <typename L, typename G>
+    requires(is_lazy_v<G>)
+    array<promote_t<L, typename G::value_type>> operator+(const array<L>& lhs, const G& gen) {
+        return binary_opr_broadcast(lhs, gen, std::plus());
+    }
+
+    template <typename G, typename R>
+    requires(is_lazy_v<G>)
+    array<promote_t<typename G::value_type, R>> operator-(const G& gen, const array<R>& rhs) {
+        return binary_opr_broadcast(gen, rhs, std::minus());
+    }
+    template <typename L, typename G>
+    requires(is_lazy_v<G>)
+    array<promote_t<L, typename G::value_type>> operator-(const array<L>& lhs, const G& gen) {
+        return binary_opr_broadcast(lhs, gen, std::minus());
+    }
+
+    template <typename G, typename R>
+    requires(is_lazy_v<G>)
+    array<promote_t<typename G::value_type, R>> operator*(const G& gen, const array<R>& rhs) {
+        return binary_opr_broadcast(gen, rhs, std::multiplies());
+    }
+    template <typename L, typename G>
+    requires(is_lazy_v<G>)
+    array<promote_t<L, typename G::value_type>> operator*(const array<L>& lhs, const G& gen) {
+        return binary_opr_broadcast(lhs, gen, std::multiplies());
+    }
+
+    template <typename G, typename R>
+    requires(is_lazy_v<G>)
+    array<promote_t<typename G::value_type, R>> operator/(const G& gen, const array<R>& rhs) {
+        return binary_opr_broadcast(gen, rhs, detail::divides());
+    }
+    template <typename L, typename G>
+    requires(is_lazy_v<G>)
+    array<promote_t<L, typename G::value_type>> operator/(const array<L>& lhs, const G& gen) {
+        return binary_opr_broadcast(lhs, gen, detail::divides());
+    }
+
+    template <typename G, typename R>
+    requires(is_lazy_v<G>)
+    array<bool> operator==(const G& gen, const array<R>& rhs) {
+        return binary_opr_broadcast(gen, rhs, std::equal_to(), operations::comparison_t());
+    }
+    template <typename L, typename G>
+    requires(is_lazy_v<G>)
+    array<bool> operator==(const array<L>& lhs, const G& gen) {
+        return binary_opr_broadcast(lhs, gen, std::equal_to(), operations::comparison_t());
+    }
+
+    template <typename G, typename R>
+    requires(is_lazy_v<G>)
+    array<bool> operator!=(const G& gen, const array<R>& rhs) {
+        return binary_opr_broadcast(gen, rhs, std::not_equal_to(), operations::comparison_t());
+    }
+    template <typename L, typename G>
+    requires(is_lazy_v<G>)
+    array<bool> operator!=(const array<L>& lhs, const G& gen) {
+        return binary_opr_broadcast(lhs, gen, std::not_equal_to(), operations::comparison_t());
+    }
+
+    template <typename G, typename R>
+    requires(is_lazy_v<G>)
+    array<bool> operator>(const G& gen, const array<R>& rhs) {
+        return binary_opr_broadcast(gen, rhs, std::greater(), operations::comparison_t());
+    }
+    template <typename L, typename G>
+    requires(is_lazy_v<G>)
+    array<bool> operator>(const array<L>& lhs, const G& gen) {
+        return binary_opr_broadcast(lhs, gen, std::greater(), operations::comparison_t());
+    }
+
+    template <typename G, typename R>
+    requires(is_lazy_v<G>)
+    array<bool> operator>=(const G& gen, const array<R>& rhs) {
+        return binary_opr_broadcast(gen, rhs, std::greater_equal(), operations::comparison_t());
+    }
+    template <typename L, typename G>
+    requires(is_lazy_v<G>)
+    array<bool> operator>=(const array<L>& lhs, const G& gen) {
+        return binary_opr_broadcast(lhs, gen, std::greater_equal(), operations::comparison_t());
+    }
+
+    template <typename G, typename R>
+    requires(is_lazy_v<G>)
+    array<bool> operator<(const G& gen, const array<R>& rhs) {
+        return binary_opr_broadcast(gen, rhs, std::less(), operations::comparison_t());
+    }
+    template <typename L, typename G>
+    requires(is_lazy_v<G>)
+    array<bool> operator<(const array<L>& lhs, const G& gen) {
+        return binary_opr_broadcast(lhs, gen, std::less(), operations::comparison_t());
+    }
+
+    template <typename G, typename R>
+    requires(is_lazy_v<G>)
+    array<bool> operator<=(const G& gen, const array<R>& rhs) {
+        return binary_opr_broadcast(gen, rhs, std::less_equal(), operations::comparison_t());
+    }
+    template <typename L, typename G>
+    requires(is_lazy_v<G>)
+    array<bool> operator<=(const array<L>& lhs, const G& gen) {
+        return binary_opr_broadcast(lhs, gen, std::less_equal(), operations::comparison_t());
+    }
 } // namespace numcpp
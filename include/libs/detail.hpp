@@ -1,30 +1,308 @@
 #pragma once
 
+// Element kernels are forced inline: in large translation units GCC otherwise stops inlining them into ufunc loops once its unit growth
+// limit is reached, and an out-of-line call per element does not vectorize.
+#if defined(__GNUC__)
+#define NUMCPP_ALWAYS_INLINE [[gnu::always_inline]] inline
+#else
+#define NUMCPP_ALWAYS_INLINE inline
+#endif
+
 namespace numcpp::detail {
+    inline size_t normalize_axis(const int8_t axis, const size_t ndim) {
+        const ll_t res = axis < 0 ? axis + ll_t(ndim) : axis;
+
+        if (res < 0 || res >= ll_t(ndim)) {
+            throw std::invalid_argument("axis out of bounds for array of dimension " + std::to_string(ndim));
+        }
+        return res;
+    }
+
+    // Strides of an operand of `shape` read as if broadcast to `res_shape`: right-aligned, zero along broadcast axes.
+    constexpr strides_t broadcast_strides(const shape_t& shape, const strides_t& strides, const shape_t& res_shape) noexcept {
+        strides_t res = {};
+        const size_t lead = res_shape.ndim - std::min<size_t>(shape.ndim, res_shape.ndim);
+
+        for (size_t i = lead; i < res_shape.ndim; i++) {
+            const size_t axis = i + shape.ndim - res_shape.ndim;
+            res[i] = shape[axis] == 1 ? 0 : strides[axis];
+        }
+        return res;
+    }
+
+    // An input of an n-ary kernel: the data, shape and strides of an array, or a scalar as a single element that broadcasts everywhere.
+    template <typename T>
+    struct operand_t {
+        const T* data;
+        shape_t shape;
+        strides_t strides;
+    };
+
+    template <typename T>
+    operand_t<T> as_operand(const array<T>& arr) noexcept {
+        return {arr.data(), arr.shape(), strides(arr)};
+    }
+    template <typename T>
+    operand_t<T> as_operand(const T& value) noexcept {
+        return {&value, shape_t(1, 1), strides_t()};
+    }
+
+    // Operands of ufunc_binary and the operator engine: arrays, read through their data, or generators, read by flat index, which is
+    // the position under contiguous strides since a generator is a single row.
+    template <typename>
+    inline constexpr bool is_operand_v = false;
+    template <typename T>
+    inline constexpr bool is_operand_v<array<T>> = true;
+    template <typename T>
+    inline constexpr bool is_operand_v<range_t<T>> = true;
     template <typename T>
-    constexpr T division_by_zero_warning(T left, const char error[]) noexcept {
-        std::cerr << "RuntimeWarning: divide by zero encountered in " << error << std::endl;
+    inline constexpr bool is_operand_v<space_t<T>> = true;
 
-        if constexpr (is_floating_point_v<T>) {
-            if (left == T()) {
-                return nan;
+    template <typename T>
+    const T* elements(const array<T>& arr) noexcept {
+        return arr.data();
+    }
+    template <typename G>
+    requires(is_lazy_v<G>)
+    const G& elements(const G& gen) noexcept {
+        return gen;
+    }
+
+    template <typename T>
+    strides_t element_strides(const array<T>& arr) noexcept {
+        return strides(arr);
+    }
+    template <typename G>
+    requires(is_lazy_v<G>)
+    strides_t element_strides(const G& gen) noexcept {
+        return contiguous_strides(gen.shape());
+    }
+
+    template <typename A>
+    using element_t = std::remove_cvref_t<decltype(elements(std::declval<const A&>())[0])>;
+
+    // Bytes an engine reads from an operand, none for a generator.
+    template <typename A>
+    size_t stored_bytes(const A& operand) noexcept {
+        return is_lazy_v<A> ? 0 : operand.size() * sizeof(element_t<A>);
+    }
+
+    // Strides viewing the elements of (shape, strides), read in `order`, as `new_shape` without a copy; false when no such strides exist.
+    inline bool reshape_strides(const shape_t& shape, const strides_t& strides, const shape_t& new_shape, const order_t order, strides_t& res) {
+        size_t old_dims[shape_t::max_ndim], new_dims[shape_t::max_ndim], old_nd = 0, new_nd = new_shape.ndim;
+        ll_t old_strides[shape_t::max_ndim], new_strides[shape_t::max_ndim];
+
+        for (size_t k = 0; k < shape.ndim; k++) {
+            const size_t d = order == order_t::C ? k : shape.ndim - 1 - k;
+
+            if (shape[d] != 1) {
+                old_dims[old_nd] = shape[d];
+                old_strides[old_nd++] = strides[d];
+            }
+        }
+        for (size_t k = 0; k < new_nd; k++) {
+            new_dims[k] = new_shape[order == order_t::C ? k : new_nd - 1 - k];
+        }
+        size_t oi = 0, oj = 1, ni = 0, nj = 1;
+
+        while (ni < new_nd && oi < old_nd) {
+            size_t np = new_dims[ni], op = old_dims[oi];
+
+            while (np != op) {
+                if (np < op) {
+                    np *= new_dims[nj++];
+                } else {
+                    op *= old_dims[oj++];
+                }
             }
-            return std::copysign(inf, left);
-        } else if constexpr (is_complex_v<T>) {
-            if (left == T()) {
-                return T(nan, nan);
+            for (size_t ok = oi; ok + 1 < oj; ok++) {
+                if (old_strides[ok] != ll_t(old_dims[ok + 1]) * old_strides[ok + 1]) {
+                    return false;
+                }
             }
-            return T(std::copysign(inf, left.real()), std::copysign(inf, left.imag()));
-        } else if constexpr (is_integral_v<T>) {
-            return T();
+            new_strides[nj - 1] = old_strides[oj - 1];
+
+            for (size_t nk = nj - 1; nk > ni; nk--) {
+                new_strides[nk - 1] = new_strides[nk] * ll_t(new_dims[nk]);
+            }
+            ni = nj++;
+            oi = oj++;
+        }
+        for (size_t nk = ni; nk < new_nd; nk++) {
+            new_strides[nk] = 1;
         }
-        return left;
+        res = {};
+
+        for (size_t k = 0; k < new_nd; k++) {
+            res[order == order_t::C ? k : new_nd - 1 - k] = new_strides[k];
+        }
+        return true;
     }
 
+    // Steps handed to strided_loop kernels for runs that are contiguous in every operand, so the compiler sees unit strides and vectorizes.
+    struct unit_steps_t {
+        constexpr ll_t operator[](size_t) const noexcept { return 1; }
+    };
+
+    // Visits `shape` in the memory order of the first operand for N operands and calls kernel(positions, n, steps) once per innermost
+    // run. Axes of extent 1 are dropped and neighbouring axes that are contiguous for every operand are merged first. Kernels take
+    // `steps` as auto so that contiguous runs get an instantiation with unit_steps_t.
+    template <size_t N, typename Kernel>
+    void strided_loop(const shape_t& shape, const std::array<strides_t, N>& strides, Kernel kernel) {
+        size_t axes[shape_t::max_ndim], dims[shape_t::max_ndim], n_axes = 0, ndim = 0;
+        std::array<strides_t, N> merged = {};
+
+        if (shape.size() == 0) {
+            return;
+        }
+        for (size_t d = 0; d < shape.ndim; d++) {
+            if (shape[d] != 1) {
+                axes[n_axes++] = d;
+            }
+        }
+        std::stable_sort(axes, axes + n_axes, [&](const size_t a, const size_t b) { return std::abs(strides[0][a]) > std::abs(strides[0][b]); });
+
+        for (size_t i = 0; i < n_axes; i++) {
+            const size_t d = axes[i];
+            bool contiguous = ndim > 0;
+
+            for (size_t k = 0; k < N && contiguous; k++) {
+                contiguous = merged[k][ndim - 1] == strides[k][d] * ll_t(shape[d]);
+            }
+            if (contiguous) {
+                dims[ndim - 1] *= shape[d];
+            } else {
+                dims[ndim++] = shape[d];
+            }
+            for (size_t k = 0; k < N; k++) {
+                merged[k][ndim - 1] = strides[k][d];
+            }
+        }
+        std::array<ll_t, N> pos = {}, steps = {};
+
+        if (ndim == 0) {
+            kernel(pos, size_t(1), steps);
+            return;
+        }
+        for (size_t k = 0; k < N; k++) {
+            steps[k] = merged[k][ndim - 1];
+        }
+        const bool unit = std::all_of(steps.begin(), steps.end(), [](const ll_t step) { return step == 1; });
+        size_t counter[shape_t::max_ndim] = {};
+
+        while (true) {
+            if (unit) {
+                kernel(pos, dims[ndim - 1], unit_steps_t());
+            } else {
+                kernel(pos, dims[ndim - 1], steps);
+            }
+            ll_t d = ndim - 2;
+
+            for (; d >= 0; d--) {
+                for (size_t k = 0; k < N; k++) {
+                    pos[k] += merged[k][d];
+                }
+                if (++counter[d] < dims[d]) {
+                    break;
+                }
+                for (size_t k = 0; k < N; k++) {
+                    pos[k] -= merged[k][d] * ll_t(dims[d]);
+                }
+                counter[d] = 0;
+            }
+            if (d < 0) {
+                return;
+            }
+        }
+    }
+    inline constexpr size_t copy_tile = 32, parallel_copy_bytes = size_t(1) << 22;
+
+    template <typename T>
+    void strided_copy_serial(const shape_t& shape, T* dst, const strides_t& dst_strides, const T* src, const strides_t& src_strides) {
+        size_t dst_axis = shape.ndim, src_axis = shape.ndim;
+
+        for (size_t d = 0; d < shape.ndim; d++) {
+            if (shape[d] >= copy_tile * 2) {
+                if (dst_axis == shape.ndim || std::abs(dst_strides[d]) < std::abs(dst_strides[dst_axis])) {
+                    dst_axis = d;
+                }
+                if (src_axis == shape.ndim || std::abs(src_strides[d]) < std::abs(src_strides[src_axis])) {
+                    src_axis = d;
+                }
+            }
+        }
+        if (dst_axis != src_axis && std::abs(dst_strides[dst_axis]) == 1 && std::abs(src_strides[src_axis]) == 1) {
+            // The fastest axes differ (a transpose): copy square tiles so both sides stay in cache.
+            const size_t ni = shape[dst_axis], nj = shape[src_axis];
+            const ll_t di = dst_strides[dst_axis], dj = dst_strides[src_axis], si = src_strides[dst_axis], sj = src_strides[src_axis];
+            shape_t outer = shape;
+            outer[dst_axis] = outer[src_axis] = 1;
+            strided_loop<2>(outer, {dst_strides, src_strides}, [&](const auto& pos, const size_t n, const auto& step) {
+                for (size_t k = 0; k < n; k++) {
+                    T* out = dst + pos[0] + ll_t(k) * step[0];
+                    const T* in = src + pos[1] + ll_t(k) * step[1];
+
+                    for (size_t ib = 0; ib < ni; ib += copy_tile) {
+                        for (size_t jb = 0; jb < nj; jb += copy_tile) {
+                            for (size_t j = jb; j < std::min(jb + copy_tile, nj); j++) {
+                                for (size_t i = ib; i < std::min(ib + copy_tile, ni); i++) {
+                                    out[ll_t(i) * di + ll_t(j) * dj] = in[ll_t(i) * si + ll_t(j) * sj];
+                                }
+                            }
+                        }
+                    }
+                }
+            });
+            return;
+        }
+        strided_loop<2>(shape, {dst_strides, src_strides}, [&](const auto& pos, const size_t n, const auto& step) {
+            if (step[0] == 1 && step[1] == 1) {
+                if constexpr (std::is_trivially_copyable_v<T>) {
+                    std::memcpy(dst + pos[0], src + pos[1], n * sizeof(T));
+                } else {
+                    std::copy_n(src + pos[1], n, dst + pos[0]);
+                }
+            } else {
+                for (size_t k = 0; k < n; k++) {
+                    dst[pos[0] + ll_t(k) * step[0]] = src[pos[1] + ll_t(k) * step[1]];
+                }
+            }
+        });
+    }
+
+    // Copies a (shape, src_strides) view into a (shape, dst_strides) one: unit-stride runs become memcpy, transposed layouts are copied in
+    // tiles and copies of at least parallel_copy_bytes are split across threads along the slowest axis of the destination.
+    template <typename T>
+    void strided_copy(const shape_t& shape, T* dst, const strides_t& dst_strides, const T* src, const strides_t& src_strides) {
+        const size_t size = shape.size();
+        size_t axis = shape.ndim;
+
+        for (size_t d = 0; d < shape.ndim; d++) {
+            if (shape[d] > 1 && (axis == shape.ndim || std::abs(dst_strides[d]) > std::abs(dst_strides[axis]))) {
+                axis = d;
+            }
+        }
+        if (size * sizeof(T) < parallel_copy_bytes || axis == shape.ndim) {
+            strided_copy_serial(shape, dst, dst_strides, src, src_strides);
+            return;
+        }
+        const size_t slice_bytes = size / shape[axis] * sizeof(T);
+        parallel_for(shape[axis], parallel_copy_bytes / 4 / slice_bytes + 1, [&](const size_t begin, const size_t end) {
+            shape_t part = shape;
+            part[axis] = end - begin;
+            strided_copy_serial(part, dst + ll_t(begin) * dst_strides[axis], dst_strides, src + ll_t(begin) * src_strides[axis], src_strides);
+        });
+    }
+
+    // Floating-point division is left to IEEE semantics so it vectorizes, the hardware exception flags recording errors for fp_scope_t.
+    // Integer division by zero would trap, so it yields zero and raises FE_DIVBYZERO instead.
     constexpr auto divides() noexcept {
         return []<typename L, typename R>(L left, R right) noexcept -> promote_t<L, R> {
-            if (right == L()) {
-                return division_by_zero_warning(left, __PRETTY_FUNCTION__);
+            if constexpr (is_integral_v<promote_t<L, R>>) {
+                if (right == R()) [[unlikely]] {
+                    std::feraiseexcept(FE_DIVBYZERO);
+                    return promote_t<L, R>();
+                }
             }
             return left / right;
         };
@@ -32,10 +310,64 @@ namespace numcpp::detail {
 
     constexpr auto modulus() noexcept {
         return []<typename L, typename R>(L left, R right) noexcept -> promote_t<L, R> {
-            if (right == L()) {
-                return division_by_zero_warning(left, __PRETTY_FUNCTION__);
+            if (right == R()) [[unlikely]] {
+                std::feraiseexcept(FE_DIVBYZERO);
+                return promote_t<L, R>();
             }
             return left % right;
         };
     }
+
+    // NaN-propagating max (greater) or min of two float32_t or float64_t values, decided on their bit patterns alone: compilers turn float
+    // selects into branches and vectorize float comparisons as signaling ones, while integer selects vectorize and never raise FE_INVALID.
+    template <bool greater, typename T>
+    NUMCPP_ALWAYS_INLINE constexpr T select_extreme(const T left, const T right) noexcept {
+        using int_t = std::conditional_t<sizeof(T) == 8, int64_t, int32_t>;
+        constexpr int_t magnitude = std::numeric_limits<int_t>::max(), inf_bits = std::bit_cast<int_t>(std::numeric_limits<T>::infinity());
+        const int_t a = std::bit_cast<int_t>(left), b = std::bit_cast<int_t>(right);
+        // Flipping the magnitude bits of negative values orders the patterns like the values, with -0 below +0.
+        const int_t key_a = a ^ ((a >> (sizeof(T) * 8 - 1)) & magnitude), key_b = b ^ ((b >> (sizeof(T) * 8 - 1)) & magnitude);
+        const bool nan_a = (a & magnitude) > inf_bits, nan_b = (b & magnitude) > inf_bits;
+        const int_t pick_a = -int_t(nan_a | (!nan_b & (greater ? key_a > key_b : key_a < key_b)));
+        return std::bit_cast<T>(b ^ ((a ^ b) & pick_a));
+    }
+
+    // NaN-propagating max and min, branch-free so that lane-wise reductions over them vectorize.
+    constexpr auto maximum() noexcept {
+        return []<typename T>(const T left, const T right) noexcept -> T {
+            if constexpr (std::is_same_v<T, float32_t> || std::is_same_v<T, float64_t>) {
+                return select_extreme<true>(left, right);
+            } else if constexpr (is_floating_point_v<T>) {
+                return std::isunordered(left, right) ? left + right : std::isgreater(left, right) ? left : right;
+            } else {
+                return left > right ? left : right;
+            }
+        };
+    }
+
+    constexpr auto minimum() noexcept {
+        return []<typename T>(const T left, const T right) noexcept -> T {
+            if constexpr (std::is_same_v<T, float32_t> || std::is_same_v<T, float64_t>) {
+                return select_extreme<false>(left, right);
+            } else if constexpr (is_floating_point_v<T>) {
+                return std::isunordered(left, right) ? left + right : std::isless(left, right) ? left : right;
+            } else {
+                return left < right ? left : right;
+            }
+        };
+    }
+
+    // condition ? left : right as a blend of bit patterns under a mask spread from condition, which vectorizes where the select would
+    // become a branch.
+    template <typename T>
+    NUMCPP_ALWAYS_INLINE constexpr T blend(const bool condition, const T left, const T right) noexcept {
+        if constexpr (std::is_arithmetic_v<T> && (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8)) {
+            using uint_t = std::conditional_t<sizeof(T) == 8, uint64_t,
+                                              std::conditional_t<sizeof(T) == 4, uint32_t, std::conditional_t<sizeof(T) == 2, uint16_t, uint8_t>>>;
+            const uint_t mask = uint_t(0) - uint_t(condition), a = std::bit_cast<uint_t>(left), b = std::bit_cast<uint_t>(right);
+            return std::bit_cast<T>(uint_t(b ^ ((a ^ b) & mask)));
+        } else {
+            return condition ? left : right;
+        }
+    }
 } // namespace numcpp::detail
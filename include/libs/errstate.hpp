@@ -0,0 +1,121 @@
+#pragma once
+#include <cfenv>
+#include <functional>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+namespace numcpp {
+    // Handling of a floating-point error category, as in numpy.seterr.
+    enum class err_mode_t : uint8_t { ignore, warn, raise, call };
+
+    struct err_settings_t {
+        err_mode_t divide = err_mode_t::warn, over = err_mode_t::warn, under = err_mode_t::ignore, invalid = err_mode_t::warn;
+
+        constexpr err_settings_t() noexcept = default;
+        constexpr explicit err_settings_t(const err_mode_t all) noexcept : divide(all), over(all), under(all), invalid(all) {}
+        constexpr err_settings_t(const err_mode_t divide, const err_mode_t over, const err_mode_t under, const err_mode_t invalid) noexcept :
+            divide(divide), over(over), under(under), invalid(invalid) {}
+    };
+
+    // Called with the category name ("divide by zero", "overflow", "underflow" or "invalid value") and its FE_* flag.
+    using err_callback_t = std::function<void(const std::string&, int)>;
+
+    namespace detail {
+        inline thread_local err_settings_t err_settings;
+        inline thread_local err_callback_t err_callback;
+        inline thread_local size_t fp_depth = 0;
+        inline constexpr int fp_error_flags = FE_DIVBYZERO | FE_OVERFLOW | FE_UNDERFLOW | FE_INVALID;
+    } // namespace detail
+
+    // Settings are per thread and return the previous ones.
+    inline err_settings_t geterr() noexcept { return detail::err_settings; }
+
+    inline err_settings_t seterr(const err_settings_t& settings) noexcept { return std::exchange(detail::err_settings, settings); }
+
+    inline err_callback_t geterrcall() { return detail::err_callback; }
+
+    inline err_callback_t seterrcall(err_callback_t callback) { return std::exchange(detail::err_callback, std::move(callback)); }
+
+    // Applies settings until the end of the enclosing scope, as numpy.errstate does.
+    class errstate_t {
+        err_settings_t saved;
+
+    public:
+        explicit errstate_t(const err_settings_t& settings) noexcept : saved(seterr(settings)) {}
+        explicit errstate_t(const err_mode_t all) noexcept : errstate_t(err_settings_t(all)) {}
+        errstate_t(const errstate_t&) = delete;
+        errstate_t& operator=(const errstate_t&) = delete;
+
+        ~errstate_t() { seterr(saved); }
+    };
+
+    namespace detail {
+        inline void report_fp_errors(const int raised) {
+            static constexpr struct {
+                int flag;
+                err_mode_t err_settings_t::* mode;
+                const char* name;
+            } categories[] = {{FE_DIVBYZERO, &err_settings_t::divide, "divide by zero"},
+                              {FE_OVERFLOW, &err_settings_t::over, "overflow"},
+                              {FE_UNDERFLOW, &err_settings_t::under, "underflow"},
+                              {FE_INVALID, &err_settings_t::invalid, "invalid value"}};
+
+            for (const auto& category : categories) {
+                if (!(raised & category.flag)) {
+                    continue;
+                }
+                switch (err_settings.*category.mode) {
+                case err_mode_t::ignore:
+                    break;
+                case err_mode_t::warn:
+                    std::cerr << "RuntimeWarning: " << category.name << " encountered\n";
+                    break;
+                case err_mode_t::raise:
+                    throw std::runtime_error(std::string("FloatingPointError: ") + category.name + " encountered");
+                case err_mode_t::call:
+                    if (!err_callback) {
+                        throw std::runtime_error("no callback set for floating point errors");
+                    }
+                    err_callback(category.name, category.flag);
+                    break;
+                }
+            }
+        }
+
+        // Brackets one array operation: the outermost scope on a thread clears the exception flags on entry and report() handles the
+        // categories raised since, once each, however many elements raised them. Inactive scopes (nested or unchecked) do nothing.
+        class fp_scope_t {
+            bool active;
+
+        public:
+            explicit fp_scope_t(const bool checked = true) noexcept : active(checked && fp_depth == 0) {
+                if (active) {
+                    fp_depth++;
+                    std::feclearexcept(fp_error_flags);
+                }
+            }
+            fp_scope_t(const fp_scope_t&) = delete;
+            fp_scope_t& operator=(const fp_scope_t&) = delete;
+
+            ~fp_scope_t() {
+                if (active) {
+                    fp_depth--;
+                }
+            }
+
+            void report() {
+                if (active) {
+                    const int raised = std::fetestexcept(fp_error_flags);
+                    std::feclearexcept(raised);
+                    fp_depth--;
+                    active = false;
+
+                    if (raised) {
+                        report_fp_errors(raised);
+                    }
+                }
+            }
+        };
+    } // namespace detail
+} // namespace numcpp
@@ -0,0 +1,345 @@
+#pragma once
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+namespace numcpp {
+    namespace detail {
+        // Expanded at compile time: a loop here is left rolled for longer polynomials, which keeps the callers from vectorizing.
+        template <typename T, size_t N, size_t... I>
+        NUMCPP_ALWAYS_INLINE constexpr T horner(const T x, const T (&coefficients)[N], std::index_sequence<I...>) noexcept {
+            T res = coefficients[N - 1];
+            ((res = res * x + coefficients[N - 2 - I]), ...);
+            return res;
+        }
+
+        template <typename T, size_t N>
+        NUMCPP_ALWAYS_INLINE constexpr T horner(const T x, const T (&coefficients)[N]) noexcept {
+            return horner(x, coefficients, std::make_index_sequence<N - 1>());
+        }
+
+        // Selects on the bit patterns. A ?: or std::min on doubles lets the compiler split the paths and sink the floating-point work
+        // into them, after which the loop only vectorizes on targets with masked vector instructions.
+        NUMCPP_ALWAYS_INLINE constexpr double select(const bool condition, const double a, const double b) noexcept {
+            const uint64_t mask = uint64_t(0) - uint64_t(condition);
+            return std::bit_cast<double>((std::bit_cast<uint64_t>(a) & mask) | (std::bit_cast<uint64_t>(b) & ~mask));
+        }
+
+        // Only taken for two float arguments, so that selects between integer literals keep going to the double one.
+        template <typename F>
+        requires(std::is_same_v<F, float>)
+        NUMCPP_ALWAYS_INLINE constexpr float select(const bool condition, const F a, const F b) noexcept {
+            const uint32_t mask = uint32_t(0) - uint32_t(condition);
+            return std::bit_cast<float>((std::bit_cast<uint32_t>(a) & mask) | (std::bit_cast<uint32_t>(b) & ~mask));
+        }
+
+        // Rounds to the nearest integer by adding 1.5 * 2^52, leaving the integer in the low bits of the sum.
+        inline constexpr double round_shifter = 0x1.8p52;
+        inline constexpr float round_shifter_f = 0x1.8p23f;
+
+        NUMCPP_ALWAYS_INLINE constexpr double pow2(const int64_t n) noexcept { return std::bit_cast<double>(uint64_t(n + 1023) << 52); }
+        NUMCPP_ALWAYS_INLINE constexpr float pow2(const int32_t n) noexcept { return std::bit_cast<float>(uint32_t(n + 127) << 23); }
+
+        inline constexpr double ln2_hi = 6.93147180369123816490e-01, ln2_lo = 1.90821492927058770002e-10;
+        inline constexpr double pi_2 = 1.57079632679489655800e+00, pi_4 = 7.85398163397448278999e-01, tan_pi_8 = 4.14213562373095145475e-01;
+
+        // Reduces x by multiples n of pi/2 into y0 + y1 (two-step Cody-Waite, accurate for |x| < 2^20 * pi/2) and returns the sine and
+        // cosine of the remainder with n, keeping y1 to first order as fdlibm does.
+        NUMCPP_ALWAYS_INLINE void sincos_reduced(const double x, double& sin_r, double& cos_r, uint64_t& quadrant) noexcept {
+            constexpr double two_over_pi = 6.36619772367581382433e-01, pio2_1 = 1.57079632673412561417e+00, pio2_2 = 6.07710050630396597660e-11,
+                             pio2_2t = 2.02226624879595063154e-21;
+            constexpr double sin_c[] = {1.0 / 120,         -1.0 / 5040,          1.0 / 362880,          -1.0 / 39916800,
+                                        1.0 / 6227020800, -1.0 / 1307674368000, 1.0 / 355687428096000};
+            constexpr double cos_c[] = {1.0 / 24,        -1.0 / 720,         1.0 / 40320,         -1.0 / 3628800,
+                                        1.0 / 479001600, -1.0 / 87178291200, 1.0 / 20922789888000};
+            const double shifted = x * two_over_pi + round_shifter, n = shifted - round_shifter;
+            const double t = x - n * pio2_1, r = t - n * pio2_2, w = n * pio2_2t - ((t - r) - n * pio2_2);
+            const double y0 = r - w, y1 = (r - y0) - w, z = y0 * y0, v = z * y0, hz = 0.5 * z, one_minus_hz = 1 - hz;
+            sin_r = y0 - ((z * (0.5 * y1 - v * horner(z, sin_c)) - y1) - v * (-1.0 / 6));
+            cos_r = one_minus_hz + (((1 - one_minus_hz) - hz) + (z * z * horner(z, cos_c) - y0 * y1));
+            quadrant = std::bit_cast<uint64_t>(shifted) & 3;
+        }
+
+        // The float32 version with the Cephes sinf and cosf polynomials, reduced in four steps whose products are exact for
+        // |x| < 2^15 * pi/2.
+        NUMCPP_ALWAYS_INLINE void sincos_reduced(const float x, float& sin_r, float& cos_r, uint32_t& quadrant) noexcept {
+            constexpr float two_over_pi = 6.36619772e-01f, pio2_1 = 1.5703125f, pio2_2 = 4.8351287841796875e-4f,
+                            pio2_3 = 3.13855707645416259765625e-7f, pio2_4 = 6.077100628276710381e-11f;
+            constexpr float sin_c[] = {-1.6666654611e-1f, 8.3321608736e-3f, -1.9515295891e-4f};
+            constexpr float cos_c[] = {4.166664568298827e-2f, -1.388731625493765e-3f, 2.443315711809948e-5f};
+            const float shifted = x * two_over_pi + round_shifter_f, n = shifted - round_shifter_f;
+            const float r = (((x - n * pio2_1) - n * pio2_2) - n * pio2_3) - n * pio2_4, z = r * r, hz = 0.5f * z, one_minus_hz = 1 - hz;
+            sin_r = r + r * z * horner(z, sin_c);
+            cos_r = one_minus_hz + (((1 - one_minus_hz) - hz) + z * z * horner(z, cos_c));
+            quadrant = std::bit_cast<uint32_t>(shifted) & 3;
+        }
+
+        // atan on [0, 1], folded onto [-tan(pi/8), tan(pi/8)] around pi/4.
+        NUMCPP_ALWAYS_INLINE constexpr double atan_unit(const double t) noexcept {
+            constexpr double pi_4_lo = 3.06161699786838301793e-17;
+            constexpr double atan_c[] = {-1.0 / 3, 1.0 / 5,  -1.0 / 7,  1.0 / 9,  -1.0 / 11, 1.0 / 13, -1.0 / 15, 1.0 / 17, -1.0 / 19, 1.0 / 21,
+                                         -1.0 / 23, 1.0 / 25, -1.0 / 27, 1.0 / 29, -1.0 / 31, 1.0 / 33, -1.0 / 35, 1.0 / 37, -1.0 / 39};
+            const bool folded = t > tan_pi_8;
+            const double u = select(folded, (t - 1) / (t + 1), t), z = u * u;
+            return select(folded, pi_4, 0) + (u + (select(folded, pi_4_lo, 0) + u * z * horner(z, atan_c)));
+        }
+
+        NUMCPP_ALWAYS_INLINE double log1p_fast(double);
+    } // namespace detail
+
+    // Branch-free kernels made of +, *, /, sqrt, bit selects and bit casts, so that loops calling them vectorize where std:: calls
+    // cannot. exp, log, sin, cos and tan have float32 kernels of their own, which fill twice as many lanes; the other float32
+    // functions are evaluated in float64 and rounded once. Largest errors against long double, checked by tests/fastmath_ulp.cpp:
+    //   float64: exp log sin cos 1 ulp, arctan 2, tan 2.5, arctan2 arcsin sinh cosh tanh arcsinh 3, arccos arccosh arctanh 3.5,
+    //            power about 2 * |y * ln(x)| (exp of a rounded product);
+    //   float32: exp log 1 ulp, sin cos 2.5, tan 3.5, the others 0.5.
+    // sin, cos and tan are accurate for |x| < 2^20 * pi/2 in float64 and 2^15 * pi/2 in float32, lose digits beyond and give NaN
+    // past 2^51 in float64. Results that underflow are gradual, zero and out of domain arguments raise the same exceptions as std::,
+    // while NaN and infinite arguments may raise FE_INVALID where std:: does not. Loops vectorize with GCC at -O3 for AVX2 and
+    // later; those using sqrt (arcsin, arccos, arcsinh, arccosh) also need -fno-math-errno.
+    namespace math::fast {
+        NUMCPP_ALWAYS_INLINE double exp(const double x) noexcept {
+            constexpr double log2e = 1.44269504088896338700e+00;
+            constexpr double exp_c[] = {1.0 / 2,       1.0 / 6,        1.0 / 24,        1.0 / 120,        1.0 / 720,        1.0 / 5040,
+                                        1.0 / 40320,   1.0 / 362880,   1.0 / 3628800,   1.0 / 39916800,   1.0 / 479001600,  1.0 / 6227020800};
+            // The exponent is clamped on integers and arguments outside (-746, 710) get a zero remainder, so that they come out as
+            // 2^-1075 or 2^1025, that is 0 or inf with the matching exception flag. inf and NaN are passed through.
+            constexpr int64_t shifter_bits = std::bit_cast<int64_t>(detail::round_shifter);
+            const int64_t k = std::min(std::max(std::bit_cast<int64_t>(x * log2e + detail::round_shifter) - shifter_bits, int64_t(-1075)),
+                                       int64_t(1025));
+            const double n = std::bit_cast<double>(k + shifter_bits) - detail::round_shifter;
+            const double r = detail::select((x <= -746) | (x >= 710), 0, (x - n * detail::ln2_hi) - n * detail::ln2_lo);
+            const int64_t half = int64_t(uint64_t(k + 2048) >> 1) - 1024;
+            const bool passed = (x == std::numeric_limits<double>::infinity()) | (x != x);
+            const double res = (1 + (r + r * r * detail::horner(r, exp_c))) * detail::pow2(half) * detail::select(passed, 1, detail::pow2(k - half));
+            return detail::select(passed, x, res);
+        }
+
+        NUMCPP_ALWAYS_INLINE double log(const double x) noexcept {
+            constexpr double sqrt2 = 1.41421356237309514547e+00;
+            constexpr double log_c[] = {2.0 / 3, 2.0 / 5, 2.0 / 7, 2.0 / 9, 2.0 / 11, 2.0 / 13, 2.0 / 15, 2.0 / 17, 2.0 / 19, 2.0 / 21, 2.0 / 23};
+            const bool subnormal = std::abs(x) < 0x1p-1022;
+            const uint64_t bits = std::bit_cast<uint64_t>(x * detail::select(subnormal, 0x1p54, 1));
+            const double m = std::bit_cast<double>((bits & 0x000fffffffffffffull) | 0x3ff0000000000000ull);
+            const bool high = m > sqrt2;
+            const double f = m * detail::select(high, 0.5, 1) - 1, s = f / (2 + f), z = s * s, hfsq = 0.5 * f * f;
+            const double biased = std::bit_cast<double>(bits >> 52 | std::bit_cast<uint64_t>(detail::round_shifter)) - detail::round_shifter;
+            const double e = biased - detail::select(subnormal, 1077, 1023) + detail::select(high, 1, 0);
+            const double res = e * detail::ln2_hi - ((hfsq - (s * (hfsq + z * detail::horner(z, log_c)) + e * detail::ln2_lo)) - f);
+            // Evaluated for every element, raising FE_DIVBYZERO only for zero and FE_INVALID only for negative arguments.
+            const double pole = -1 / detail::select(x == 0, 0, 1), domain = 0 / detail::select(x < 0, 0, 1);
+            const double special = detail::select(x == 0, pole, detail::select(x < 0, domain, x));
+            return detail::select((x > 0) & (x < std::numeric_limits<double>::infinity()), res, special);
+        }
+
+        NUMCPP_ALWAYS_INLINE double sin(const double x) noexcept {
+            double s, c;
+            uint64_t q;
+            detail::sincos_reduced(x, s, c, q);
+            const double res = detail::select(q & 1, c, s);
+            return detail::select(q & 2, -res, res);
+        }
+
+        NUMCPP_ALWAYS_INLINE double cos(const double x) noexcept {
+            double s, c;
+            uint64_t q;
+            detail::sincos_reduced(x, s, c, q);
+            const double res = detail::select(q & 1, s, c);
+            return detail::select((q + 1) & 2, -res, res);
+        }
+
+        NUMCPP_ALWAYS_INLINE double tan(const double x) noexcept {
+            double s, c;
+            uint64_t q;
+            detail::sincos_reduced(x, s, c, q);
+            return detail::select(q & 1, -c, s) / detail::select(q & 1, s, c);
+        }
+
+        NUMCPP_ALWAYS_INLINE double arctan(const double x) noexcept {
+            const double a = std::abs(x);
+            const double r = detail::atan_unit(detail::select(a > 1, 1, a) / detail::select(a > 1, a, 1));
+            return std::copysign(detail::select(a > 1, detail::pi_2 - r, r), x);
+        }
+
+        NUMCPP_ALWAYS_INLINE double arctan2(const double y, const double x) noexcept {
+            const double a = std::abs(x), b = std::abs(y);
+            const bool swapped = b > a, infinite = (a == std::numeric_limits<double>::infinity()) & (b == a), zero = (a == 0) & (b == 0);
+            const double big = detail::select(swapped, b, a), small = detail::select(swapped, a, b);
+            const double r = detail::atan_unit(detail::select(infinite, 1, small) / detail::select(infinite | zero, 1, big));
+            const double octant = detail::select(swapped, detail::pi_2 - r, r);
+            return std::copysign(detail::select(std::copysign(1.0, x) < 0, 2 * detail::pi_2 - octant, octant), y);
+        }
+
+        // Square roots take provably non-negative arguments so that only -fno-math-errno is needed for them to be inlined, and out of
+        // domain arguments select a NaN computed for every element as in log.
+        NUMCPP_ALWAYS_INLINE double arcsin(const double x) noexcept {
+            const bool outside = std::abs(x) > 1;
+            const double y = detail::select(outside, 0, x), a = std::abs(y), domain = 0 / detail::select(outside, 0, 1);
+            return detail::select(outside, domain, 2 * arctan(y / (1 + std::sqrt(std::abs((1 - a) * (1 + a))))));
+        }
+
+        NUMCPP_ALWAYS_INLINE double arccos(const double x) noexcept {
+            const bool outside = std::abs(x) > 1;
+            const double y = detail::select(outside, 0, x), domain = 0 / detail::select(outside, 0, 1);
+            return detail::select(outside, domain, 2 * arctan2(std::sqrt(std::abs(1 - y)), std::sqrt(std::abs(1 + y))));
+        }
+
+        NUMCPP_ALWAYS_INLINE double sinh(const double x) noexcept {
+            constexpr double sinh_c[] = {1.0 / 6,           1.0 / 120,           1.0 / 5040,               1.0 / 362880,
+                                         1.0 / 39916800,    1.0 / 6227020800,    1.0 / 1307674368000,      1.0 / 355687428096000,
+                                         1.0 / 121645100408832000, 1.0 / 51090942171709440000.0};
+            const double a = std::abs(x), small = a + a * a * a * detail::horner(a * a, sinh_c);
+            const bool high = a > 709;
+            const double e = exp(detail::select(high, 0.5 * a, a)), half = detail::select(high, (0.5 * e) * e, 0.5 * e);
+            return std::copysign(detail::select(a < 1, small, half - 0.5 / e), x);
+        }
+
+        // Near the top of the range exp(a) overflows while cosh(a) does not, so exp(a / 2) is squared instead.
+        NUMCPP_ALWAYS_INLINE double cosh(const double x) noexcept {
+            const double a = std::abs(x);
+            const bool high = a > 709;
+            const double e = exp(detail::select(high, 0.5 * a, a));
+            return detail::select(high, (0.5 * e) * e, 0.5 * e) + 0.5 / e;
+        }
+
+        NUMCPP_ALWAYS_INLINE double tanh(const double x) noexcept {
+            const double a = detail::select(std::abs(x) > 20, 20, std::abs(x)), e = exp(a);
+            const double small = sinh(a) / (0.5 * e + 0.5 / e), large = 1 - 2 / (e * e + 1);
+            return std::copysign(detail::select(a < 1, small, large), x);
+        }
+
+        NUMCPP_ALWAYS_INLINE double arcsinh(const double x) noexcept {
+            const double a = std::abs(x), b = detail::select(a > 0x1p28, 0x1p28, a);
+            const double large = log(detail::select(a > 0x1p28, a, 1)) + detail::ln2_hi + detail::ln2_lo;
+            const double res = detail::log1p_fast(b + b * b / (1 + std::sqrt(1 + b * b)));
+            return std::copysign(detail::select(a > 0x1p28, large, res), x);
+        }
+
+        NUMCPP_ALWAYS_INLINE double arccosh(const double x) noexcept {
+            const double b = detail::select(x > 0x1p28, 0x1p28, detail::select(x < 1, 1, x)), t = b - 1, domain = 0 / detail::select(x < 1, 0, 1);
+            const double large = log(detail::select(x > 0x1p28, x, 1)) + detail::ln2_hi + detail::ln2_lo;
+            const double res = detail::log1p_fast(t + std::sqrt(std::abs(t * (b + 1))));
+            return detail::select(x < 1, domain, detail::select(x > 0x1p28, large, res));
+        }
+
+        NUMCPP_ALWAYS_INLINE double arctanh(const double x) noexcept {
+            const double a = std::abs(x);
+            return std::copysign(0.5 * detail::log1p_fast(2 * a / (1 - a)), x);
+        }
+
+        // Zero bases and the cases that are 1 whatever the other argument are taken apart, so that they do not go through log(0) or
+        // 0 * inf. Negative bases run on |x|: y is an integer when |y| + 2^52 rounds back to it, odd when |y| / 2 does not, odd y
+        // give the sign of x and other y give NaN for finite bases.
+        NUMCPP_ALWAYS_INLINE double power(const double x, const double y) noexcept {
+            constexpr double inf = std::numeric_limits<double>::infinity();
+            const double a = std::abs(x), b = std::abs(y), h = 0.5 * b;
+            const double t = detail::select(b >= 0x1p52, b, b + 0x1p52), u = detail::select(h >= 0x1p52, h, h + 0x1p52);
+            const bool integral = (b >= 0x1p52) | (t - 0x1p52 == b), odd = integral & !((h >= 0x1p52) | (u - 0x1p52 == h));
+            const bool zero = a == 0, one = (x == 1) | (y == 0) | ((x == -1) & (b == inf));
+            const bool infinite = y == -inf, outside = (x < 0) & (x > -inf) & !integral & !one;
+            const double pole = detail::select(infinite, -y, 1 / detail::select(zero & (y < 0) & !infinite, 0, 1));
+            const double res = exp(detail::select(zero | one, 0, y) * log(detail::select(zero | one, 1, a)));
+            const double magnitude = detail::select(one, 1, detail::select(zero, detail::select(y > 0, 0, pole), res));
+            const double domain = 0 / detail::select(outside, 0, 1);
+            return detail::select(outside, domain, detail::select(odd & !one, std::copysign(magnitude, x), magnitude));
+        }
+
+        // float32 lanes with the Cephes expf, logf, sinf and cosf polynomials, on the same reductions as the float64 kernels.
+        NUMCPP_ALWAYS_INLINE float exp(const float x) noexcept {
+            constexpr float log2e = 1.44269504e+00f, ln2_hi = 6.93359375e-01f, ln2_lo = -2.12194440e-04f;
+            constexpr float exp_c[] = {5.0000001201e-1f, 1.6666665459e-1f, 4.1665795894e-2f, 8.3334519073e-3f, 1.3981999507e-3f, 1.9875691500e-4f};
+            constexpr int32_t shifter_bits = std::bit_cast<int32_t>(detail::round_shifter_f);
+            const int32_t k = std::min(std::max(std::bit_cast<int32_t>(x * log2e + detail::round_shifter_f) - shifter_bits, int32_t(-150)),
+                                       int32_t(129));
+            const float n = std::bit_cast<float>(k + shifter_bits) - detail::round_shifter_f;
+            const float r = detail::select((x <= -104.0f) | (x >= 89.0f), 0.0f, (x - n * ln2_hi) - n * ln2_lo);
+            const int32_t half = int32_t(uint32_t(k + 256) >> 1) - 128;
+            const bool passed = (x == std::numeric_limits<float>::infinity()) | (x != x);
+            const float scale = detail::select(passed, 1.0f, detail::pow2(k - half));
+            const float res = (1 + (r + r * r * detail::horner(r, exp_c))) * detail::pow2(half) * scale;
+            return detail::select(passed, x, res);
+        }
+
+        NUMCPP_ALWAYS_INLINE float log(const float x) noexcept {
+            constexpr float sqrt1_2 = 7.07106781e-01f, ln2_hi = 6.93359375e-01f, ln2_lo = -2.12194440e-04f;
+            constexpr float log_c[] = {3.3333331174e-1f,  -2.4999993993e-1f, 2.0000714765e-1f,  -1.6668057665e-1f, 1.4249322787e-1f,
+                                       -1.2420140846e-1f, 1.1676998740e-1f,  -1.1514610310e-1f, 7.0376836292e-2f};
+            const bool subnormal = std::abs(x) < 0x1p-126f;
+            const uint32_t bits = std::bit_cast<uint32_t>(x * detail::select(subnormal, 0x1p25f, 1.0f));
+            const float m = std::bit_cast<float>((bits & 0x007fffffu) | 0x3f000000u);
+            const bool low = m < sqrt1_2;
+            const float f = detail::select(low, m + m, m) - 1, z = f * f;
+            const float e = float(int32_t(bits >> 23) - 126 - 25 * int32_t(subnormal) - int32_t(low));
+            const float res = (f + ((f * z * detail::horner(f, log_c) + e * ln2_lo) - 0.5f * z)) + e * ln2_hi;
+            const float pole = -1 / detail::select(x == 0, 0.0f, 1.0f), domain = 0 / detail::select(x < 0, 0.0f, 1.0f);
+            const float special = detail::select(x == 0, pole, detail::select(x < 0, domain, x));
+            return detail::select((x > 0) & (x < std::numeric_limits<float>::infinity()), res, special);
+        }
+
+        NUMCPP_ALWAYS_INLINE float sin(const float x) noexcept {
+            float s, c;
+            uint32_t q;
+            detail::sincos_reduced(x, s, c, q);
+            const float res = detail::select(q & 1, c, s);
+            return detail::select(q & 2, -res, res);
+        }
+
+        NUMCPP_ALWAYS_INLINE float cos(const float x) noexcept {
+            float s, c;
+            uint32_t q;
+            detail::sincos_reduced(x, s, c, q);
+            const float res = detail::select(q & 1, s, c);
+            return detail::select((q + 1) & 2, -res, res);
+        }
+
+        NUMCPP_ALWAYS_INLINE float tan(const float x) noexcept {
+            float s, c;
+            uint32_t q;
+            detail::sincos_reduced(x, s, c, q);
+            return detail::select(q & 1, -c, s) / detail::select(q & 1, s, c);
+        }
+
+        NUMCPP_ALWAYS_INLINE float arctan(const float x) noexcept { return float(arctan(double(x))); }
+        NUMCPP_ALWAYS_INLINE float arctan2(const float y, const float x) noexcept { return float(arctan2(double(y), double(x))); }
+        NUMCPP_ALWAYS_INLINE float arcsin(const float x) noexcept { return float(arcsin(double(x))); }
+        NUMCPP_ALWAYS_INLINE float arccos(const float x) noexcept { return float(arccos(double(x))); }
+        NUMCPP_ALWAYS_INLINE float sinh(const float x) noexcept { return float(sinh(double(x))); }
+        NUMCPP_ALWAYS_INLINE float cosh(const float x) noexcept { return float(cosh(double(x))); }
+        NUMCPP_ALWAYS_INLINE float tanh(const float x) noexcept { return float(tanh(double(x))); }
+        NUMCPP_ALWAYS_INLINE float arcsinh(const float x) noexcept { return float(arcsinh(double(x))); }
+        NUMCPP_ALWAYS_INLINE float arccosh(const float x) noexcept { return float(arccosh(double(x))); }
+        NUMCPP_ALWAYS_INLINE float arctanh(const float x) noexcept { return float(arctanh(double(x))); }
+        NUMCPP_ALWAYS_INLINE float power(const float x, const float y) noexcept { return float(power(double(x), double(y))); }
+    } // namespace math::fast
+
+    namespace detail {
+        // log(1 + z) from log(u) with u = 1 + z, corrected by z / (u - 1) for the rounding of u.
+        NUMCPP_ALWAYS_INLINE double log1p_fast(const double z) {
+            const double u = 1 + z;
+            const bool exact = (u == 1) | (u == std::numeric_limits<double>::infinity());
+            return select(exact, z, math::fast::log(u) * (select(exact, 1, z) / select(exact, 1, u - 1)));
+        }
+
+        // Integral arguments run through the float64 kernels, float32 ones through the float32 overloads, long double through std::.
+        template <typename T, precision_t precision>
+        inline constexpr bool uses_fast_math = precision == precision_t::fast && (is_integral_v<T> || std::is_same_v<T, float32_t> ||
+                                                                                  std::is_same_v<T, float64_t>);
+
+        template <typename T>
+        using fast_math_t = std::conditional_t<std::is_same_v<T, float32_t>, float32_t, float64_t>;
+
+        // Calls body(std::integral_constant<precision_t, P>) for the runtime policy, so each policy gets its own kernel instantiation
+        // and the choice is not tested per element.
+        template <typename Body>
+        decltype(auto) with_precision(const precision_t precision, Body body) {
+            if (precision == precision_t::fast) {
+                return body(std::integral_constant<precision_t, precision_t::fast>());
+            }
+            return body(std::integral_constant<precision_t, precision_t::accurate>());
+        }
+    } // namespace detail
+} // namespace numcpp
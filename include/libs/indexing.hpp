@@ -1,16 +1,38 @@
 #pragma once
 
 namespace numcpp {
+    namespace detail {
+        // New results take the layout most operands are contiguous in, so Fortran-ordered inputs are streamed in memory order.
+        template <typename... Arrays>
+        order_t result_order(const Arrays&... arrays) noexcept {
+            const int votes = ((is_contiguous(arrays.shape(), element_strides(arrays), order_t::F) -
+                                is_contiguous(arrays.shape(), element_strides(arrays))) + ...);
+            return votes > 0 ? order_t::F : order_t::C;
+        }
+    } // namespace detail
+
     constexpr bool can_broadcast_shape(const shape_t& shape1, const shape_t& shape2) {
-        return (shape1.rows == shape2.rows || shape1.rows == 1 || shape2.rows == 1) &&
-            (shape1.cols == shape2.cols || shape1.cols == 1 || shape2.cols == 1);
+        for (size_t i = 1; i <= std::min(shape1.ndim, shape2.ndim); i++) {
+            const size_t dim1 = shape1[shape1.ndim - i], dim2 = shape2[shape2.ndim - i];
+
+            if (dim1 != dim2 && dim1 != 1 && dim2 != 1) {
+                return false;
+            }
+        }
+        return true;
     }
 
     inline shape_t broadcast_shape(const shape_t& shape1, const shape_t& shape2) {
         if (!can_broadcast_shape(shape1, shape2)) {
             throw std::invalid_argument("Cannot broadcast shapes");
         }
-        return {std::max(shape1.rows, shape2.rows), std::max(shape1.cols, shape2.cols)};
+        shape_t res = shape1.ndim >= shape2.ndim ? shape1 : shape2;
+
+        for (size_t i = 1; i <= std::min(shape1.ndim, shape2.ndim); i++) {
+            const size_t dim1 = shape1[shape1.ndim - i], dim2 = shape2[shape2.ndim - i];
+            res[res.ndim - i] = dim1 == 1 ? dim2 : dim1;
+        }
+        return res;
     }
 
     constexpr ll_t broadcast_index(const ll_t idx, const size_t dim) noexcept { return dim == 1 ? 0 : idx; }
@@ -19,109 +41,198 @@ namespace numcpp {
         if (!index.is_scalar()) {
             throw std::invalid_argument("broadcast_index: expected scalar indies");
         }
-        return {(broadcast_index(index.get_scalar_row(), shape.rows)), (broadcast_index(index.get_scalar_col(), shape.cols))};
+        return {(broadcast_index(index.get_scalar_row(), shape.rows())), (broadcast_index(index.get_scalar_col(), shape.cols()))};
     }
 
-    template <typename L, typename R, typename Op, typename Operation = none_t<>>
-    array<promote_t<L, R, Operation>> binary_opr_broadcast(const array<L>& lhs, const array<R>& rhs, Op opr, Operation = none_t()) {
+    // Either operand may be a generator, whose elements are computed as they are read; an in-place lhs must be an array.
+    template <typename A, typename B, typename Op, typename Operation = none_t<>>
+    requires(detail::is_operand_v<A> && detail::is_operand_v<B>)
+    array<promote_t<detail::element_t<A>, detail::element_t<B>, Operation>> binary_opr_broadcast(const A& lhs, const B& rhs, Op opr,
+                                                                                              Operation = none_t()) {
+        using L = detail::element_t<A>;
+        using R = detail::element_t<B>;
         using T = promote_t<L, R, Operation>;
+        using U = promote_t<L, R>;
         const shape_t lhs_shape = lhs.shape(), rhs_shape = rhs.shape();
         const shape_t res_shape = broadcast_shape(lhs_shape, rhs_shape);
-        buffer_t<T> result;
-        size_t idx = 0;
+        NUMCPP_PROFILE_SCOPE(binary_opr_broadcast, res_shape.size(), detail::stored_bytes(lhs) + detail::stored_bytes(rhs),
+                             res_shape.size() * sizeof(T));
+        detail::fp_scope_t fp_errors(!std::is_same_v<T, bool>);
 
         if constexpr (std::is_same_v<Operation, operations::in_place_t>) {
-            result = buffer(lhs);
-            idx = offset(lhs);
-        } else {
-            result = buffer_t<T>(res_shape.size());
-        }
-        for (ll_t i = 0; i < res_shape.rows; i++) {
-            for (ll_t j = 0; j < res_shape.cols; j++) {
-                result[idx++] = opr(static_cast<T>(lhs[broadcast_index({i, j}, lhs_shape)]), static_cast<T>(rhs[broadcast_index({i, j}, rhs_shape)]));
+            if (lhs_shape != res_shape) {
+                throw std::invalid_argument("non-broadcastable output operand");
             }
         }
-        return array<T>(std::move(result), res_shape);
+        array<T> result;
+        array<T>& target = [&]() -> array<T>& {
+            if constexpr (std::is_same_v<Operation, operations::in_place_t>) {
+                return const_cast<array<T>&>(lhs);
+            } else {
+                return result = array<T>(buffer_t<T>(res_shape.size()), res_shape, detail::result_order(lhs, rhs));
+            }
+        }();
+        T* res = target.data();
+        const auto& lhs_ptr = detail::elements(lhs);
+        const auto& rhs_ptr = detail::elements(rhs);
+        detail::strided_loop<3>(res_shape,
+                                {strides(target), detail::broadcast_strides(lhs_shape, detail::element_strides(lhs), res_shape),
+                                 detail::broadcast_strides(rhs_shape, detail::element_strides(rhs), res_shape)},
+                                [&](const auto& pos, const size_t n, const auto& step) {
+                                    for (size_t k = 0; k < n; k++) {
+                                        const U left = static_cast<U>(lhs_ptr[pos[1] + ll_t(k) * step[1]]);
+                                        const U right = static_cast<U>(rhs_ptr[pos[2] + ll_t(k) * step[2]]);
+                                        res[pos[0] + ll_t(k) * step[0]] = opr(left, right);
+                                    }
+                                });
+        fp_errors.report();
+        return result;
     }
 
     template <typename L, typename R, typename Op, typename Operation = none_t<>>
     array<promote_t<L, R, Operation>> binary_opr_element_wise(const array<L>& lhs, const R& value, Op opr, Operation = none_t()) {
         using T = promote_t<L, R, Operation>;
+        using U = promote_t<L, R>;
         const shape_t shape = lhs.shape();
-        buffer_t<T> result;
-        size_t idx = 0;
-
-        if constexpr (std::is_same_v<Operation, operations::in_place_t>) {
-            result = buffer(lhs);
-            idx = offset(lhs);
-        } else {
-            result = buffer_t<T>(lhs.size());
-        }
-        for (ll_t i = 0; i < shape.rows; i++) {
-            for (ll_t j = 0; j < shape.cols; j++) {
+        NUMCPP_PROFILE_SCOPE(binary_opr_element_wise, shape.size(), shape.size() * sizeof(L), shape.size() * sizeof(T));
+        detail::fp_scope_t fp_errors(!std::is_same_v<T, bool>);
+        array<T> result;
+        array<T>& target = [&]() -> array<T>& {
+            if constexpr (std::is_same_v<Operation, operations::in_place_t>) {
+                return const_cast<array<T>&>(lhs);
+            } else {
+                return result = array<T>(buffer_t<T>(shape.size()), shape, detail::result_order(lhs));
+            }
+        }();
+        T* res = target.data();
+        const L* lhs_ptr = lhs.data();
+        detail::strided_loop<2>(shape, {strides(target), strides(lhs)}, [&](const auto& pos, const size_t n, const auto& step) {
+            for (size_t k = 0; k < n; k++) {
                 if constexpr (std::is_same_v<Operation, operations::swap_t>) {
-                    result[idx] = opr(value, static_cast<T>(lhs[{i, j}]));
+                    res[pos[0] + ll_t(k) * step[0]] = opr(value, static_cast<U>(lhs_ptr[pos[1] + ll_t(k) * step[1]]));
                 } else {
-                    result[idx] = opr(static_cast<T>(lhs[{i, j}]), value);
+                    res[pos[0] + ll_t(k) * step[0]] = opr(static_cast<U>(lhs_ptr[pos[1] + ll_t(k) * step[1]]), value);
                 }
-                idx++;
+            }
+        });
+        fp_errors.report();
+        return result;
+    }
+
+    template <typename G, typename R, typename Op, typename Operation = none_t<>>
+    requires(is_lazy_v<G>)
+    array<promote_t<typename G::value_type, R, Operation>> binary_opr_element_wise(const G& gen, const R& value, Op opr, Operation = none_t()) {
+        using T = promote_t<typename G::value_type, R, Operation>;
+        using U = promote_t<typename G::value_type, R>;
+        const size_t size = gen.size();
+        NUMCPP_PROFILE_SCOPE(binary_opr_element_wise, size, 0, size * sizeof(T));
+        detail::fp_scope_t fp_errors(!std::is_same_v<T, bool>);
+        buffer_t<T> result(size);
+
+        for (size_t i = 0; i < size; i++) {
+            if constexpr (std::is_same_v<Operation, operations::swap_t>) {
+                result[i] = opr(value, static_cast<U>(gen[i]));
+            } else {
+                result[i] = opr(static_cast<U>(gen[i]), value);
             }
         }
-        return array<T>(std::move(result), shape);
+        fp_errors.report();
+        return array<T>(std::move(result), gen.shape());
     }
 
     template <typename T, typename Op>
     array<T> unary_opr_element_wise(const array<T>& lhs, Op opr) {
         const shape_t shape = lhs.shape();
-        buffer_t<T> result;
-        size_t idx = 0;
-        result = buffer_t<T>(lhs.size());
-
-        for (ll_t i = 0; i < shape.rows; i++) {
-            for (ll_t j = 0; j < shape.cols; j++) {
-                result[idx++] = opr(static_cast<T>(lhs[{i, j}]));
+        NUMCPP_PROFILE_SCOPE(unary_opr_element_wise, shape.size(), shape.size() * sizeof(T), shape.size() * sizeof(T));
+        detail::fp_scope_t fp_errors(!std::is_same_v<T, bool>);
+        array<T> result(buffer_t<T>(shape.size()), shape, detail::result_order(lhs));
+        T* res = result.data();
+        const T* lhs_ptr = lhs.data();
+        detail::strided_loop<2>(shape, {strides(result), strides(lhs)}, [&](const auto& pos, const size_t n, const auto& step) {
+            for (size_t k = 0; k < n; k++) {
+                res[pos[0] + ll_t(k) * step[0]] = opr(static_cast<T>(lhs_ptr[pos[1] + ll_t(k) * step[1]]));
             }
-        }
-        return array<T>(std::move(result), shape);
+        });
+        fp_errors.report();
+        return result;
     }
 
     template <typename T>
     array<T> array<T>::operator[](const index_t& index) const {
-        if (index.is_scalar()) {
-            auto [i, j] = index.get_scalars();
-
+        auto resolve = [](ll_t i, const size_t dim) {
             if (i < 0) {
-                i += row;
+                i += dim;
             }
-            if (j < 0) {
-                j += col;
-            }
-            if (i < 0 || i >= row || j < 0 || j >= col) {
+            if (i < 0 || i >= ll_t(dim)) {
                 throw std::out_of_range("Index out of bounds");
             }
-            return array(buffer, {1, 1}, offset + i * row_stride + j * col_stride, row_stride, col_stride, (base ? base : this), false, true, true);
-        }
-        if (index.is_scalar_row() && index.is_slice_col()) {
-            ll_t i = index.get_scalar_row();
-            slice_t cols = index.get_slice_col().resolve(col);
+            return i;
+        };
+
+        if (!index.has_array()) {
+            buffer.detach();
 
-            if (!is_matrix) {
-                return operator[]({0, i});
+            if (index.size() > dims.ndim) {
+                throw std::out_of_range("too many indices for array");
             }
-            if (i < 0) {
-                i += row;
+            if (!is_matrix && dims.ndim == 2 && index.size() == 1) {
+                const size_t axis = dims.rows() > 1 ? 0 : 1, dim = dims[axis];
+
+                if (index.is_scalar(0)) {
+                    return array(buffer, {1, 1}, {1, 1}, offset + resolve(index.get_scalar(0), dim) * strides[axis], base ? base : this, false,
+                                 true, true);
+                }
+                slice_t slice = index.get_slice(0).resolve(dim);
+                shape_t res_shape = dims;
+                strides_t res_strides = strides;
+                res_shape[axis] = slice.size(dim);
+                res_strides[axis] *= slice.step;
+                return array(buffer, res_shape, res_strides, offset + (res_shape[axis] ? slice.start * strides[axis] : 0), base ? base : this, false,
+                             false, true);
             }
-            if (i < 0 || i >= row) {
-                throw std::out_of_range("Row index out of bounds");
+            size_t res_dims[shape_t::max_ndim], n = 0;
+            strides_t res_strides = {};
+            ll_t res_offset = offset;
+            bool all_scalar = index.size() == dims.ndim;
+
+            for (size_t d = 0; d < dims.ndim; d++) {
+                if (index.is_scalar(d)) {
+                    res_offset += resolve(index.get_scalar(d), dims[d]) * strides[d];
+
+                    if (dims.ndim == 2 && d == 1) {
+                        res_dims[n] = 1;
+                        res_strides[n++] = strides[d];
+                    }
+                } else {
+                    slice_t slice = index.get_slice(d).resolve(dims[d]);
+                    res_dims[n] = slice.size(dims[d]);
+                    res_strides[n++] = strides[d] * slice.step;
+                    all_scalar = false;
+
+                    if (res_dims[n - 1]) {
+                        res_offset += slice.start * strides[d];
+                    }
+                }
+            }
+            if (all_scalar) {
+                return array(buffer, {1, 1}, {1, 1}, res_offset, base ? base : this, false, true, true);
             }
-            return array(buffer, {1, cols.size(col)}, offset + i * row_stride + cols.start * col_stride, row_stride, col_stride * cols.step,
-                         base ? base : this, false, false, true);
+            const shape_t res_shape(res_dims, n);
+            const size_t pad = res_shape.ndim - n;
+            std::copy_backward(res_strides.begin(), res_strides.begin() + n, res_strides.begin() + n + pad);
+            std::fill_n(res_strides.begin(), pad, 0);
+            return array(buffer, res_shape, res_strides, res_offset, base ? base : this, n >= 2, false, true);
         }
+        if (dims.ndim > 2) {
+            throw std::invalid_argument("integer array indexing is only supported on 2-D arrays");
+        }
+        const size_t row = dims.rows(), col = dims.cols();
+
         if (index.is_scalar_row() && index.is_array_col()) {
             ll_t x = index.get_scalar_row();
             const array<ll_t> y(*index.get_array_col());
             size_t idx = 0;
-            auto [rows, cols] = y.shape();
+            const size_t rows = y.shape().rows(), cols = y.shape().cols();
             buffer_t<T> buf(y.size());
 
             for (ll_t i = 0; i < rows; i++) {
@@ -131,30 +242,10 @@ namespace numcpp {
             }
             return array(std::move(buf), {rows, cols});
         }
-        if (index.is_slice_row() && index.is_scalar_col()) {
-            slice_t rows = index.get_slice_row().resolve(row);
-            ll_t j = index.get_scalar_col();
-
-            if (j < 0) {
-                j += col;
-            }
-            if (j < 0 || j >= col) {
-                throw std::out_of_range("Column index out of bounds");
-            }
-            return array(buffer, {rows.size(row), 1}, offset + rows.start * row_stride + j * col_stride, row_stride * rows.step, col_stride,
-                         base ? base : this, true, false, true);
-        }
-        if (index.is_slice()) {
-            auto [rows, cols] = index.get_slices();
-            rows.resolve(row);
-            cols.resolve(col);
-            return array(buffer, {rows.size(row), cols.size(col)}, offset + rows.start * row_stride + cols.start * col_stride, row_stride * rows.step,
-                         col_stride * cols.step, base ? base : this, true, false, true);
-        }
         if (index.is_slice_row() && index.is_array_col()) {
             slice_t x = index.get_slice_row().resolve(row);
             const array<ll_t> y(*index.get_array_col());
-            auto [rows, cols] = y.shape();
+            const size_t rows = y.shape().rows(), cols = y.shape().cols();
 
             if (rows > 1) {
                 throw std::invalid_argument("Higher dimension than 2D are not supported");
@@ -175,7 +266,7 @@ namespace numcpp {
             const array<ll_t> x(*index.get_array_row());
             ll_t y = index.get_scalar_col();
             size_t idx = 0;
-            auto [rows, cols] = x.shape();
+            const size_t rows = x.shape().rows(), cols = x.shape().cols();
             buffer_t<T> buf(x.size());
 
             for (ll_t i = 0; i < rows; i++) {
@@ -187,8 +278,8 @@ namespace numcpp {
         }
         if (index.is_array_row() && index.is_slice_col()) {
             const array<ll_t> x(*index.get_array_row());
-            slice_t y = index.get_slice_col().resolve(row);
-            auto [rows, cols] = x.shape();
+            slice_t y = index.get_slice_col().resolve(col);
+            const size_t rows = x.shape().rows(), cols = x.shape().cols();
 
             if (rows > 1) {
                 throw std::invalid_argument("Higher dimension than 2D are not supported");
@@ -198,10 +289,10 @@ namespace numcpp {
 
             for (ll_t i = 0; i < rows; i++) {
                 for (ll_t j = 0; j < cols; j++) {
-                    const ll_t row = x[{i, j}];
+                    const ll_t r = x[{i, j}];
 
                     for (ll_t k = y.start; k < y.stop; k += y.step) {
-                        buf[idx++] = (*this)[{row, k}];
+                        buf[idx++] = (*this)[{r, k}];
                     }
                 }
             }
@@ -214,8 +305,8 @@ namespace numcpp {
             size_t idx = 0;
             buffer_t<T> result(res.size());
 
-            for (ll_t i = 0; i < res.rows; i++) {
-                for (ll_t j = 0; j < res.cols; j++) {
+            for (ll_t i = 0; i < res.rows(); i++) {
+                for (ll_t j = 0; j < res.cols(); j++) {
                     result[idx++] = (*this)[{static_cast<ll_t>(row_array[broadcast_index({i, j}, row_shape)]),
                                              static_cast<ll_t>(col_array[broadcast_index({i, j}, col_shape)])}];
                 }
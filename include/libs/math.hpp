@@ -7,6 +7,8 @@ namespace numcpp::math {
     dtype absolute(const T& x) {
         if constexpr (is_complex_v<T>) {
             return static_cast<dtype>(x.abs());
+        } else if constexpr (std::is_unsigned_v<T>) {
+            return static_cast<dtype>(x);
         } else {
             return static_cast<dtype>(std::abs(x));
         }
@@ -15,84 +17,153 @@ namespace numcpp::math {
     template <typename T, typename dtype = bool>
     requires(is_numeric_v<T>)
     dtype all(const array<T>& a, const where_t& where) {
-        auto [row, col] = a.shape();
-        const shape_t shape = where ? where->shape() : none::shape;
+        const shape_t shape = a.shape();
+        const T* ptr = a.data();
 
-        for (ll_t i = 0; i < row; i++) {
-            for (ll_t j = 0; j < col; j++) {
-                if ((!where || (*where)[broadcast_index({i, j}, shape)]) && !static_cast<bool>(a[{i, j}])) {
-                    return false;
-                }
-            }
+        if (where && shape != broadcast_shape(shape, where.shape())) {
+            throw std::invalid_argument("Cannot broadcast where shape to array shape");
         }
-        return true;
+        bool res = true;
+        auto scan = [&](const auto mask) {
+            detail::strided_loop<2>(shape, {strides(a), where ? detail::broadcast_strides(where.shape(), where.strides(), shape) : strides_t()},
+                                    [&](const auto& pos, const size_t n, const auto& step) {
+                                        for (size_t k = 0; k < n && res; k++) {
+                                            if ((!mask || mask[pos[1] + ll_t(k) * step[1]]) && !static_cast<bool>(ptr[pos[0] + ll_t(k) * step[0]])) {
+                                                res = false;
+                                            }
+                                        }
+                                    });
+        };
+
+        if (where) {
+            where.visit(scan);
+        } else {
+            scan(static_cast<const bool*>(nullptr));
+        }
+        return res;
     }
 
+    // |a - b| <= atol + rtol * |b| for finite b, a == b otherwise, as NumPy's isclose. Integers are compared as float64 so that the
+    // difference cannot overflow. The operators are non-short-circuiting so that loops over it stay branch-free.
     template <typename T, typename U>
     requires(is_numeric_v<T> && is_numeric_v<U>)
-    bool allclose(const T& a, const U& b, const float64_t rtol, const float64_t atol, const bool equal_nan) {
-        if (std::isnan(a) && std::isnan(b)) {
-            return equal_nan;
+    NUMCPP_ALWAYS_INLINE bool allclose(const T& a, const U& b, const float64_t rtol, const float64_t atol, const bool equal_nan) {
+        using V = std::conditional_t<is_integral_v<promote_t<T, U>>, float64_t, promote_t<T, U>>;
+        using R = real_t<V>;
+        const V x = static_cast<V>(a), y = static_cast<V>(b);
+        const R abs_y = absolute(y);
+        return ((absolute(x - y) <= R(atol) + R(rtol) * abs_y) & (abs_y < std::numeric_limits<R>::infinity())) | (x == y) |
+            (equal_nan & (x != x) & (y != y));
+    }
+
+    template <typename T, typename dtype = real_t<T>>
+    requires(is_numeric_v<T>)
+    dtype angle(const T& z, const bool deg) {
+        if constexpr (is_complex_v<T>) {
+            return static_cast<dtype>(deg ? z.arg() * (180 / pi) : z.arg());
+        } else {
+            return static_cast<dtype>(z < T() ? (deg ? 180 : pi) : 0);
         }
-        return absolute(a - b) <= atol + rtol * absolute(b);
     }
 
     template <typename T, typename dtype = bool>
     requires(is_numeric_v<T>)
     dtype any(const array<T>& a, const where_t& where) {
-        auto [row, col] = a.shape();
-        const shape_t shape = where ? where->shape() : none::shape;
+        const shape_t shape = a.shape();
+        const T* ptr = a.data();
+
+        if (where && shape != broadcast_shape(shape, where.shape())) {
+            throw std::invalid_argument("Cannot broadcast where shape to array shape");
+        }
+        bool res = false;
+        auto scan = [&](const auto mask) {
+            detail::strided_loop<2>(shape, {strides(a), where ? detail::broadcast_strides(where.shape(), where.strides(), shape) : strides_t()},
+                                    [&](const auto& pos, const size_t n, const auto& step) {
+                                        for (size_t k = 0; k < n && !res; k++) {
+                                            if ((!mask || mask[pos[1] + ll_t(k) * step[1]]) && static_cast<bool>(ptr[pos[0] + ll_t(k) * step[0]])) {
+                                                res = true;
+                                            }
+                                        }
+                                    });
+        };
 
-        for (ll_t i = 0; i < row; i++) {
-            for (ll_t j = 0; j < col; j++) {
-                if ((!where || (*where)[broadcast_index({i, j}, shape)]) && static_cast<bool>(a[{i, j}])) {
-                    return true;
-                }
-            }
+        if (where) {
+            where.visit(scan);
+        } else {
+            scan(static_cast<const bool*>(nullptr));
         }
-        return false;
+        return res;
     }
 
-    template <typename T, typename dtype = T>
+    template <typename T, typename dtype = T, precision_t precision = precision_t::accurate>
     requires(is_real_v<T>)
-    dtype arccos(const T& x) {
-        return std::acos(x);
+    NUMCPP_ALWAYS_INLINE dtype arccos(const T& x) {
+        if constexpr (detail::uses_fast_math<T, precision>) {
+            return static_cast<dtype>(fast::arccos(static_cast<detail::fast_math_t<T>>(x)));
+        } else {
+            return static_cast<dtype>(std::acos(x));
+        }
     }
 
-    template <typename T, typename dtype = T>
+    template <typename T, typename dtype = T, precision_t precision = precision_t::accurate>
     requires(is_real_v<T>)
-    dtype arccosh(const T& x) {
-        return std::acosh(x);
+    NUMCPP_ALWAYS_INLINE dtype arccosh(const T& x) {
+        if constexpr (detail::uses_fast_math<T, precision>) {
+            return static_cast<dtype>(fast::arccosh(static_cast<detail::fast_math_t<T>>(x)));
+        } else {
+            return static_cast<dtype>(std::acosh(x));
+        }
     }
 
-    template <typename T, typename dtype = T>
+    template <typename T, typename dtype = T, precision_t precision = precision_t::accurate>
     requires(is_real_v<T>)
-    dtype arcsin(const T& x) {
-        return std::asin(x);
+    NUMCPP_ALWAYS_INLINE dtype arcsin(const T& x) {
+        if constexpr (detail::uses_fast_math<T, precision>) {
+            return static_cast<dtype>(fast::arcsin(static_cast<detail::fast_math_t<T>>(x)));
+        } else {
+            return static_cast<dtype>(std::asin(x));
+        }
     }
 
-    template <typename T, typename dtype = T>
+    template <typename T, typename dtype = T, precision_t precision = precision_t::accurate>
     requires(is_real_v<T>)
-    dtype arcsinh(const T& x) {
-        return std::asinh(x);
+    NUMCPP_ALWAYS_INLINE dtype arcsinh(const T& x) {
+        if constexpr (detail::uses_fast_math<T, precision>) {
+            return static_cast<dtype>(fast::arcsinh(static_cast<detail::fast_math_t<T>>(x)));
+        } else {
+            return static_cast<dtype>(std::asinh(x));
+        }
     }
 
-    template <typename T, typename dtype = T>
+    template <typename T, typename dtype = T, precision_t precision = precision_t::accurate>
     requires(is_real_v<T>)
-    dtype arctan(const T& x) {
-        return std::atan(x);
+    NUMCPP_ALWAYS_INLINE dtype arctan(const T& x) {
+        if constexpr (detail::uses_fast_math<T, precision>) {
+            return static_cast<dtype>(fast::arctan(static_cast<detail::fast_math_t<T>>(x)));
+        } else {
+            return static_cast<dtype>(std::atan(x));
+        }
     }
 
-    template <typename T, typename U, typename dtype = promote_t<T, U>>
+    template <typename T, typename U, typename dtype = promote_t<T, U>, precision_t precision = precision_t::accurate>
     requires(is_real_v<T> && is_real_v<U>)
-    dtype arctan2(const T& y, const U& x) {
-        return std::atan2(y, x);
+    NUMCPP_ALWAYS_INLINE dtype arctan2(const T& y, const U& x) {
+        if constexpr (detail::uses_fast_math<promote_t<T, U>, precision>) {
+            using fast_t = detail::fast_math_t<promote_t<T, U>>;
+            return static_cast<dtype>(fast::arctan2(static_cast<fast_t>(y), static_cast<fast_t>(x)));
+        } else {
+            return static_cast<dtype>(std::atan2(y, x));
+        }
     }
 
-    template <typename T, typename dtype = T>
+    template <typename T, typename dtype = T, precision_t precision = precision_t::accurate>
     requires(is_real_v<T>)
-    dtype arctanh(const T& x) {
-        return std::atanh(x);
+    NUMCPP_ALWAYS_INLINE dtype arctanh(const T& x) {
+        if constexpr (detail::uses_fast_math<T, precision>) {
+            return static_cast<dtype>(fast::arctanh(static_cast<detail::fast_math_t<T>>(x)));
+        } else {
+            return static_cast<dtype>(std::atanh(x));
+        }
     }
 
     template <typename T>
@@ -129,18 +200,117 @@ namespace numcpp::math {
         }
     }
 
+    // Rounds half to even to a multiple of 1 / factor, or of factor when coarse, where factor is 10^|decimals| as in NumPy's around.
+    template <typename T, typename dtype = T>
+    requires(is_numeric_v<T>)
+    NUMCPP_ALWAYS_INLINE dtype around(const T& x, const float64_t factor, const bool coarse) {
+        if constexpr (is_complex_v<T>) {
+            return static_cast<dtype>(T(around(x.real, factor, coarse), around(x.imag, factor, coarse)));
+        } else if constexpr (is_integral_v<T>) {
+            return static_cast<dtype>(coarse ? std::nearbyint(float64_t(x) / factor) * factor : x);
+        } else {
+            return static_cast<dtype>(coarse ? std::nearbyint(x / T(factor)) * T(factor) : std::nearbyint(x * T(factor)) / T(factor));
+        }
+    }
+
+    // min(max(x, a_min), a_max) with NaN propagated from any of the three, branch-free through the NaN-propagating max and min.
+    template <typename T>
+    requires(is_real_v<T>)
+    NUMCPP_ALWAYS_INLINE T clip(const T& x, const T& a_min, const T& a_max) {
+        return detail::minimum()(detail::maximum()(x, a_min), a_max);
+    }
+
+    template <typename T, typename dtype = T>
+    requires(is_numeric_v<T>)
+    dtype conj(const T& x) {
+        if constexpr (is_complex_v<T>) {
+            return static_cast<dtype>(x.conj());
+        } else {
+            return static_cast<dtype>(x);
+        }
+    }
+
+    template <typename T, typename dtype = T, precision_t precision = precision_t::accurate>
+    requires(is_real_v<T>)
+    NUMCPP_ALWAYS_INLINE dtype cos(const T& x) {
+        if constexpr (detail::uses_fast_math<T, precision>) {
+            return static_cast<dtype>(fast::cos(static_cast<detail::fast_math_t<T>>(x)));
+        } else {
+            return static_cast<dtype>(std::cos(x));
+        }
+    }
+
+    template <typename T, typename dtype = T, precision_t precision = precision_t::accurate>
+    requires(is_real_v<T>)
+    NUMCPP_ALWAYS_INLINE dtype cosh(const T& x) {
+        if constexpr (detail::uses_fast_math<T, precision>) {
+            return static_cast<dtype>(fast::cosh(static_cast<detail::fast_math_t<T>>(x)));
+        } else {
+            return static_cast<dtype>(std::cosh(x));
+        }
+    }
+
+    // x == y, NaN also equal to NaN with equal_nan; x != x is false for every integer, so no NaN test is compiled for them.
     template <typename T, typename U>
-    bool equal(const array<T>& x, const array<U>& y, const bool equal_nan) {
-        auto itr1 = x.begin(), itr2 = y.begin(), end = x.end();
+    requires(is_numeric_v<T> && is_numeric_v<U>)
+    NUMCPP_ALWAYS_INLINE bool equal(const T& x, const U& y, const bool equal_nan) {
+        using V = promote_t<T, U>;
+        const V a = static_cast<V>(x), b = static_cast<V>(y);
+        return (a == b) | (equal_nan & (a != a) & (b != b));
+    }
+
+    template <typename T, typename dtype = T, precision_t precision = precision_t::accurate>
+    requires(is_numeric_v<T>)
+    NUMCPP_ALWAYS_INLINE dtype exp(const T& x) {
+        if constexpr (is_complex_v<T>) {
+            return static_cast<dtype>(T::from_polar(exp<real_t<T>, real_t<T>, precision>(x.real), x.imag));
+        } else if constexpr (detail::uses_fast_math<T, precision>) {
+            return static_cast<dtype>(fast::exp(static_cast<detail::fast_math_t<T>>(x)));
+        } else {
+            return static_cast<dtype>(std::exp(x));
+        }
+    }
 
-        while (itr1 != end) {
-            if (*itr1 != *itr2 || (std::isnan(*itr1) && std::isnan(*itr2) && !equal_nan)) {
-                return false;
-            }
-            ++itr1;
-            ++itr2;
+    template <typename T, typename dtype = T, precision_t precision = precision_t::accurate>
+    requires(is_real_v<T>)
+    NUMCPP_ALWAYS_INLINE dtype log(const T& x) {
+        if constexpr (detail::uses_fast_math<T, precision>) {
+            return static_cast<dtype>(fast::log(static_cast<detail::fast_math_t<T>>(x)));
+        } else {
+            return static_cast<dtype>(std::log(x));
+        }
+    }
+
+    // Replaces NaN, +inf and -inf in x, in each part of a complex x. The float32_t and float64_t cases test the bit patterns and blend, so
+    // no float comparison is vectorized as a signaling one.
+    template <typename T>
+    requires(is_numeric_v<T>)
+    NUMCPP_ALWAYS_INLINE T nan_to_num(const T& x, const real_t<T> nan, const real_t<T> posinf, const real_t<T> neginf) {
+        if constexpr (is_complex_v<T>) {
+            return T(nan_to_num(x.real, nan, posinf, neginf), nan_to_num(x.imag, nan, posinf, neginf));
+        } else if constexpr (std::is_same_v<T, float32_t> || std::is_same_v<T, float64_t>) {
+            using int_t = std::conditional_t<sizeof(T) == 8, int64_t, int32_t>;
+            constexpr int_t magnitude = std::numeric_limits<int_t>::max(), inf_bits = std::bit_cast<int_t>(std::numeric_limits<T>::infinity());
+            const int_t bits = std::bit_cast<int_t>(x);
+            const T finite = detail::blend(bits == inf_bits, posinf, detail::blend(bits == (inf_bits | ~magnitude), neginf, x));
+            return detail::blend((bits & magnitude) > inf_bits, nan, finite);
+        } else if constexpr (is_floating_point_v<T>) {
+            return std::isnan(x) ? nan : std::isinf(x) ? (x > 0 ? posinf : neginf) : x;
+        } else {
+            return x;
+        }
+    }
+
+    // Integer powers stay on std::pow under the fast policy, since exp(y * log(x)) is not exact for them.
+    template <typename T, typename U, typename dtype = promote_t<T, U>, precision_t precision = precision_t::accurate>
+    requires(is_real_v<T> && is_real_v<U>)
+    NUMCPP_ALWAYS_INLINE dtype power(const T& x, const U& y) {
+        if constexpr (is_floating_point_v<promote_t<T, U>> && detail::uses_fast_math<promote_t<T, U>, precision>) {
+            using fast_t = detail::fast_math_t<promote_t<T, U>>;
+            return static_cast<dtype>(fast::power(static_cast<fast_t>(x), static_cast<fast_t>(y)));
+        } else {
+            return static_cast<dtype>(std::pow(x, y));
         }
-        return true;
     }
 
     template <typename T, typename dtype = T>
@@ -149,6 +319,46 @@ namespace numcpp::math {
         return 180 * x / pi;
     }
 
+    template <typename T, typename dtype = T, precision_t precision = precision_t::accurate>
+    requires(is_real_v<T>)
+    NUMCPP_ALWAYS_INLINE dtype sin(const T& x) {
+        if constexpr (detail::uses_fast_math<T, precision>) {
+            return static_cast<dtype>(fast::sin(static_cast<detail::fast_math_t<T>>(x)));
+        } else {
+            return static_cast<dtype>(std::sin(x));
+        }
+    }
+
+    template <typename T, typename dtype = T, precision_t precision = precision_t::accurate>
+    requires(is_real_v<T>)
+    NUMCPP_ALWAYS_INLINE dtype sinh(const T& x) {
+        if constexpr (detail::uses_fast_math<T, precision>) {
+            return static_cast<dtype>(fast::sinh(static_cast<detail::fast_math_t<T>>(x)));
+        } else {
+            return static_cast<dtype>(std::sinh(x));
+        }
+    }
+
+    template <typename T, typename dtype = T, precision_t precision = precision_t::accurate>
+    requires(is_real_v<T>)
+    NUMCPP_ALWAYS_INLINE dtype tan(const T& x) {
+        if constexpr (detail::uses_fast_math<T, precision>) {
+            return static_cast<dtype>(fast::tan(static_cast<detail::fast_math_t<T>>(x)));
+        } else {
+            return static_cast<dtype>(std::tan(x));
+        }
+    }
+
+    template <typename T, typename dtype = T, precision_t precision = precision_t::accurate>
+    requires(is_real_v<T>)
+    NUMCPP_ALWAYS_INLINE dtype tanh(const T& x) {
+        if constexpr (detail::uses_fast_math<T, precision>) {
+            return static_cast<dtype>(fast::tanh(static_cast<detail::fast_math_t<T>>(x)));
+        } else {
+            return static_cast<dtype>(std::tanh(x));
+        }
+    }
+
     template <typename T, typename dtype = T>
     requires(is_real_v<T>)
     dtype floor(const T& x) {
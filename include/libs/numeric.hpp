@@ -5,7 +5,7 @@ namespace numcpp {
     template <typename T, typename dtype = T>
     requires(is_numeric_v<T>)
     array<dtype> absolute(const array<T>& x, out_t<dtype> out = none::out<dtype>, const where_t& where = none::where) {
-        return ufunc_unary(x, out, where, &math::absolute<T, dtype>);
+        return ufunc_unary(x, out, where, [](const T& value) { return math::absolute<T, dtype>(value); });
     }
     template <typename dtype, typename T>
     requires(is_numeric_v<T>)
@@ -17,6 +17,12 @@ namespace numcpp {
     array<dtype> absolute(const array<T>& x, const where_t& where) {
         return absolute(x, none::out<dtype>, where);
     }
+    template <typename G, typename dtype = typename G::value_type>
+    requires(is_lazy_v<G> && is_numeric_v<typename G::value_type>)
+    array<dtype> absolute(const G& x, out_t<dtype> out = none::out<dtype>, const where_t& where = none::where) {
+        using T = typename G::value_type;
+        return ufunc_unary(x, out, where, [](const T& value) { return math::absolute<T, dtype>(value); });
+    }
 
     template <typename T, typename dtype = T>
     requires(is_numeric_v<T>)
@@ -34,6 +40,16 @@ namespace numcpp {
         return absolute(x, where);
     }
 
+    // Running op along axis, of the flattened array for none::axis, as NumPy's ufunc.accumulate; op must be associative.
+    template <typename T, typename Op, typename dtype = T>
+    array<dtype> accumulate(const array<T>& a, Op op, const int8_t axis = none::axis, out_t<dtype> out = none::out<dtype>) {
+        return ufunc_accumulate(a, axis, out, op);
+    }
+    template <typename dtype, typename T, typename Op>
+    array<dtype> accumulate(const array<T>& a, Op op, const int8_t axis = none::axis) {
+        return accumulate(a, op, axis, none::out<dtype>);
+    }
+
     template <typename T, typename U, typename dtype = promote_t<T, U>>
     array<dtype> add(const array<T>& x, const array<U>& y, out_t<dtype> out = none::out<dtype>, const where_t& where = none::where) {
         return ufunc_binary(x, y, out, where, std::plus());
@@ -56,11 +72,14 @@ namespace numcpp {
     array<dtype> all(const array<T>& a, const int8_t axis = none::axis, const bool keepdims = false, const where_t& where = none::where) {
         return all(a, axis, none::out<dtype>, keepdims, where);
     }
+    inline bool all(const bitmask_t& mask) noexcept { return mask.all(); }
 
     template <typename T, typename U>
     requires(is_numeric_v<T> && is_numeric_v<U>)
     bool allclose(const array<T>& a, const array<U>& b, const float64_t rtol = 1e-5, const float64_t atol = 1e-8, const bool equal_nan = false) {
-        return ufunc_axes_binary(a, b, none::axis, none::out<bool>, false, &math::allclose<T, U>, rtol, atol, equal_nan);
+        return ufunc_all_pairs(detail::as_operand(a), detail::as_operand(b), [=](const T& x, const U& y) {
+            return math::allclose(x, y, rtol, atol, equal_nan);
+        });
     }
     template <typename T, typename U>
     requires(is_numeric_v<T> && is_numeric_v<U>)
@@ -68,25 +87,47 @@ namespace numcpp {
         return allclose(a, b, 1e-5, 1e-8, equal_nan);
     }
 
+    // Maximum along axis that propagates NaN; a result that selects no element needs an initial value.
     template <typename T>
+    requires(is_real_v<T>)
     array<T> amax(const array<T>& a, const int8_t axis = none::axis, out_t<T> out = none::out<T>, const bool keepdims = false,
-                  const T initial = none::initial<T>, const where_t& where = none::where) {
-        // implementation of max()
-        return array<T>();
+                  const std::optional<std::type_identity_t<T>> initial = std::nullopt, const where_t& where = none::where) {
+        if (!initial && detail::selects_nothing(a, axis, where)) {
+            throw std::invalid_argument("zero-size array to reduction operation maximum which has no identity");
+        }
+        return ufunc_reduce(a, axis, out, keepdims, where,
+                            detail::reducer_t{detail::maximum(), none::initial<T>, initial.value_or(none::initial<T>)});
+    }
+    template <typename T>
+    requires(is_real_v<T>)
+    array<T> amax(const array<T>& a, const int8_t axis, const bool keepdims, const std::optional<std::type_identity_t<T>> initial = std::nullopt,
+                  const where_t& where = none::where) {
+        return amax(a, axis, none::out<T>, keepdims, initial, where);
     }
 
+    // Minimum along axis that propagates NaN; a result that selects no element needs an initial value.
     template <typename T>
+    requires(is_real_v<T>)
     array<T> amin(const array<T>& a, const int8_t axis = none::axis, out_t<T> out = none::out<T>, const bool keepdims = false,
-                  const T initial = none::initial<T>, const where_t& where = none::where) {
-        // implementation of min()
-        return array<T>();
+                  const std::optional<std::type_identity_t<T>> initial = std::nullopt, const where_t& where = none::where) {
+        const T identity = is_floating_point_v<T> ? T(inf) : std::numeric_limits<T>::max();
+
+        if (!initial && detail::selects_nothing(a, axis, where)) {
+            throw std::invalid_argument("zero-size array to reduction operation minimum which has no identity");
+        }
+        return ufunc_reduce(a, axis, out, keepdims, where, detail::reducer_t{detail::minimum(), identity, initial.value_or(identity)});
+    }
+    template <typename T>
+    requires(is_real_v<T>)
+    array<T> amin(const array<T>& a, const int8_t axis, const bool keepdims, const std::optional<std::type_identity_t<T>> initial = std::nullopt,
+                  const where_t& where = none::where) {
+        return amin(a, axis, none::out<T>, keepdims, initial, where);
     }
 
     template <typename T>
     requires(is_numeric_v<T>)
-    array<real_t<T>> angle(array<T>& z, const bool deg = false) {
-        array<real_t<T>> res = arctan2(z.imag(), z.real());
-        return deg ? rad2deg(res, out_t(res)) : res;
+    array<real_t<T>> angle(const array<T>& z, const bool deg = false) {
+        return ufunc_unary(z, none::out<real_t<T>>, none::where, [deg](const T& x) { return math::angle(x, deg); });
     }
 
     template <typename T, typename dtype = bool>
@@ -98,148 +139,280 @@ namespace numcpp {
     array<dtype> any(const array<T>& a, const int8_t axis = none::axis, const bool keepdims = false, const where_t& where = none::where) {
         return any(a, axis, none::out<dtype>, keepdims, where);
     }
+    inline bool any(const bitmask_t& mask) noexcept { return mask.any(); }
 
     template <typename T, typename U, typename dtype = promote_t<T, U>>
     array<dtype> append(const array<T>& arr, const array<U>& values, const int8_t axis = none::axis) {
         const shape_t arr_shape = arr.shape(), values_shape = values.shape();
-        shape_t res_shape;
 
         if (axis == none::axis) {
-            res_shape = shape_t(arr_shape.size() + values_shape.size());
-        } else if (axis == 0 || axis == -2) {
-            if (values_shape.cols != arr_shape.cols) {
-                throw std::invalid_argument("dimension of values mis-match with arr");
-            }
-            res_shape = shape_t(arr_shape.rows + values_shape.rows, arr_shape.cols);
-        } else if (axis == 1 || axis == -1) {
-            if (values_shape.rows != arr_shape.rows) {
+            const size_t size = arr_shape.size() + values_shape.size();
+            buffer_t<dtype> buf(size);
+            std::copy(values.begin(), values.end(), std::copy(arr.begin(), arr.end(), buf.data()));
+            return array(std::move(buf), size);
+        }
+        const size_t ax = detail::normalize_axis(axis, arr_shape.ndim);
+        shape_t res_shape = arr_shape;
+        res_shape[ax] += values_shape[ax];
+
+        if (values_shape.ndim != arr_shape.ndim) {
+            throw std::invalid_argument("dimension of values mis-match with arr");
+        }
+        for (size_t d = 0; d < arr_shape.ndim; d++) {
+            if (d != ax && values_shape[d] != arr_shape[d]) {
                 throw std::invalid_argument("dimension of values mis-match with arr");
             }
-            res_shape = shape_t(arr_shape.rows, arr_shape.cols + values_shape.cols);
-        } else {
-            throw std::invalid_argument("other axes are not suppoerted");
+        }
+        size_t outer = 1, arr_chunk = 1, values_chunk = 1;
+
+        for (size_t d = 0; d < arr_shape.ndim; d++) {
+            (d < ax ? outer : arr_chunk) *= arr_shape[d];
+            values_chunk *= d < ax ? 1 : values_shape[d];
         }
         buffer_t<dtype> buf(res_shape.size());
-        std::copy(arr.begin(), arr.end(), buf.data());
-        std::copy(values.begin(), values.end(), buf.data() + arr_shape.size());
+        dtype* ptr = buf.data();
+        auto arr_it = arr.begin();
+        auto values_it = values.begin();
+
+        for (size_t i = 0; i < outer; i++) {
+            ptr = std::copy_n(arr_it, arr_chunk, ptr);
+            ptr = std::copy_n(values_it, values_chunk, ptr);
+            arr_it += arr_chunk;
+            values_it += values_chunk;
+        }
         return array(std::move(buf), res_shape);
     }
 
+    // The lazy_ generators compute element i as start + i * step on demand; unary ufuncs, ufunc_binary and the arithmetic and comparison
+    // operators consume them without materializing the sequence, and they convert to array<T> on assignment. arange, linspace and
+    // logspace return the array.
+    template <typename T>
+    range_t<T> lazy_arange(const range_t<T>& range) {
+        return range;
+    }
+
+    template <typename T = float64_t>
+    requires(is_floating_point_v<T>)
+    space_t<T> lazy_linspace(const std::type_identity_t<T> start, const std::type_identity_t<T> stop, const size_t num = 50,
+                             const bool endpoint = true) {
+        return space_t<T>(start, stop, num, endpoint);
+    }
+
+    template <typename T = float64_t>
+    requires(is_floating_point_v<T>)
+    space_t<T> lazy_logspace(const std::type_identity_t<T> start, const std::type_identity_t<T> stop, const size_t num = 50,
+                             const bool endpoint = true, const std::type_identity_t<T> base = 10) {
+        if (base == T(0)) {
+            throw std::invalid_argument("logspace base cannot be zero");
+        }
+        return space_t<T>(start, stop, num, endpoint, base);
+    }
+
     template <typename T>
     array<T> arange(const range_t<T>& range) {
-        return array(range.evaluate(), range.size());
+        return lazy_arange(range);
+    }
+
+    template <typename T = float64_t>
+    requires(is_floating_point_v<T>)
+    array<T> linspace(const std::type_identity_t<T> start, const std::type_identity_t<T> stop, const size_t num = 50, const bool endpoint = true) {
+        return lazy_linspace<T>(start, stop, num, endpoint);
+    }
+
+    template <typename T = float64_t>
+    requires(is_floating_point_v<T>)
+    array<T> logspace(const std::type_identity_t<T> start, const std::type_identity_t<T> stop, const size_t num = 50, const bool endpoint = true,
+                      const std::type_identity_t<T> base = 10) {
+        return lazy_logspace<T>(start, stop, num, endpoint, base);
     }
 
     template <typename T, typename dtype = T>
     requires(is_real_v<T>)
-    array<dtype> arccos(const array<T>& x, out_t<dtype> out = none::out<dtype>, const where_t& where = none::where) {
-        return ufunc_unary(x, out, where, &math::arccos<T, dtype>);
+    array<dtype> arccos(const array<T>& x, out_t<dtype> out = none::out<dtype>, const where_t& where = none::where,
+                        const precision_t precision = precision_t::accurate) {
+        return detail::with_precision(precision, [&](auto policy) {
+            return ufunc_unary(x, out, where, [](const T& value) { return math::arccos<T, dtype, decltype(policy)::value>(value); });
+        });
     }
     template <typename dtype, typename T>
     requires(is_real_v<T>)
-    array<dtype> arccos(const array<T>& x, const where_t& where = none::where) {
-        return arccos(x, none::out<dtype>, where);
+    array<dtype> arccos(const array<T>& x, const where_t& where = none::where, const precision_t precision = precision_t::accurate) {
+        return arccos(x, none::out<dtype>, where, precision);
     }
     template <typename T, typename dtype = T>
     requires(is_real_v<T>)
-    array<dtype> arccos(const array<T>& x, const where_t& where) {
-        return arccos(x, none::out<dtype>, where);
+    array<dtype> arccos(const array<T>& x, const where_t& where, const precision_t precision = precision_t::accurate) {
+        return arccos(x, none::out<dtype>, where, precision);
+    }
+    template <typename G, typename dtype = typename G::value_type>
+    requires(is_lazy_v<G> && is_real_v<typename G::value_type>)
+    array<dtype> arccos(const G& x, out_t<dtype> out = none::out<dtype>, const where_t& where = none::where,
+                        const precision_t precision = precision_t::accurate) {
+        using T = typename G::value_type;
+        return detail::with_precision(precision, [&](auto policy) {
+            return ufunc_unary(x, out, where, [](const T& value) { return math::arccos<T, dtype, decltype(policy)::value>(value); });
+        });
     }
 
     template <typename T, typename dtype = T>
     requires(is_real_v<T>)
-    array<dtype> arccosh(const array<T>& x, out_t<dtype> out = none::out<dtype>, const where_t& where = none::where) {
-        return ufunc_unary(x, out, where, &math::arccosh<T, dtype>);
+    array<dtype> arccosh(const array<T>& x, out_t<dtype> out = none::out<dtype>, const where_t& where = none::where,
+                         const precision_t precision = precision_t::accurate) {
+        return detail::with_precision(precision, [&](auto policy) {
+            return ufunc_unary(x, out, where, [](const T& value) { return math::arccosh<T, dtype, decltype(policy)::value>(value); });
+        });
     }
     template <typename dtype, typename T>
     requires(is_real_v<T>)
-    array<dtype> arccosh(const array<T>& x, const where_t& where = none::where) {
-        return arccosh(x, none::out<dtype>, where);
+    array<dtype> arccosh(const array<T>& x, const where_t& where = none::where, const precision_t precision = precision_t::accurate) {
+        return arccosh(x, none::out<dtype>, where, precision);
     }
     template <typename T, typename dtype = T>
     requires(is_real_v<T>)
-    array<dtype> arccosh(const array<T>& x, const where_t& where) {
-        return arccosh(x, none::out<dtype>, where);
+    array<dtype> arccosh(const array<T>& x, const where_t& where, const precision_t precision = precision_t::accurate) {
+        return arccosh(x, none::out<dtype>, where, precision);
+    }
+    template <typename G, typename dtype = typename G::value_type>
+    requires(is_lazy_v<G> && is_real_v<typename G::value_type>)
+    array<dtype> arccosh(const G& x, out_t<dtype> out = none::out<dtype>, const where_t& where = none::where,
+                         const precision_t precision = precision_t::accurate) {
+        using T = typename G::value_type;
+        return detail::with_precision(precision, [&](auto policy) {
+            return ufunc_unary(x, out, where, [](const T& value) { return math::arccosh<T, dtype, decltype(policy)::value>(value); });
+        });
     }
 
     template <typename T, typename dtype = T>
     requires(is_real_v<T>)
-    array<dtype> arcsin(const array<T>& x, out_t<dtype> out = none::out<dtype>, const where_t& where = none::where) {
-        return ufunc_unary(x, out, where, &math::arcsin<T, dtype>);
+    array<dtype> arcsin(const array<T>& x, out_t<dtype> out = none::out<dtype>, const where_t& where = none::where,
+                        const precision_t precision = precision_t::accurate) {
+        return detail::with_precision(precision, [&](auto policy) {
+            return ufunc_unary(x, out, where, [](const T& value) { return math::arcsin<T, dtype, decltype(policy)::value>(value); });
+        });
     }
     template <typename dtype, typename T>
     requires(is_real_v<T>)
-    array<dtype> arcsin(const array<T>& x, const where_t& where = none::where) {
-        return arcsin(x, none::out<dtype>, where);
+    array<dtype> arcsin(const array<T>& x, const where_t& where = none::where, const precision_t precision = precision_t::accurate) {
+        return arcsin(x, none::out<dtype>, where, precision);
     }
     template <typename T, typename dtype = T>
     requires(is_real_v<T>)
-    array<dtype> arcsin(const array<T>& x, const where_t& where) {
-        return arcsin(x, none::out<dtype>, where);
+    array<dtype> arcsin(const array<T>& x, const where_t& where, const precision_t precision = precision_t::accurate) {
+        return arcsin(x, none::out<dtype>, where, precision);
+    }
+    template <typename G, typename dtype = typename G::value_type>
+    requires(is_lazy_v<G> && is_real_v<typename G::value_type>)
+    array<dtype> arcsin(const G& x, out_t<dtype> out = none::out<dtype>, const where_t& where = none::where,
+                        const precision_t precision = precision_t::accurate) {
+        using T = typename G::value_type;
+        return detail::with_precision(precision, [&](auto policy) {
+            return ufunc_unary(x, out, where, [](const T& value) { return math::arcsin<T, dtype, decltype(policy)::value>(value); });
+        });
     }
 
     template <typename T, typename dtype = T>
     requires(is_real_v<T>)
-    array<dtype> arcsinh(const array<T>& x, out_t<dtype> out = none::out<dtype>, const where_t& where = none::where) {
-        return ufunc_unary(x, out, where, &math::arcsinh<T, dtype>);
+    array<dtype> arcsinh(const array<T>& x, out_t<dtype> out = none::out<dtype>, const where_t& where = none::where,
+                         const precision_t precision = precision_t::accurate) {
+        return detail::with_precision(precision, [&](auto policy) {
+            return ufunc_unary(x, out, where, [](const T& value) { return math::arcsinh<T, dtype, decltype(policy)::value>(value); });
+        });
     }
     template <typename dtype, typename T>
     requires(is_real_v<T>)
-    array<dtype> arcsinh(const array<T>& x, const where_t& where = none::where) {
-        return arcsinh(x, none::out<dtype>, where);
+    array<dtype> arcsinh(const array<T>& x, const where_t& where = none::where, const precision_t precision = precision_t::accurate) {
+        return arcsinh(x, none::out<dtype>, where, precision);
     }
     template <typename T, typename dtype = T>
     requires(is_real_v<T>)
-    array<dtype> arcsinh(const array<T>& x, const where_t& where) {
-        return arcsinh(x, none::out<dtype>, where);
+    array<dtype> arcsinh(const array<T>& x, const where_t& where, const precision_t precision = precision_t::accurate) {
+        return arcsinh(x, none::out<dtype>, where, precision);
+    }
+    template <typename G, typename dtype = typename G::value_type>
+    requires(is_lazy_v<G> && is_real_v<typename G::value_type>)
+    array<dtype> arcsinh(const G& x, out_t<dtype> out = none::out<dtype>, const where_t& where = none::where,
+                         const precision_t precision = precision_t::accurate) {
+        using T = typename G::value_type;
+        return detail::with_precision(precision, [&](auto policy) {
+            return ufunc_unary(x, out, where, [](const T& value) { return math::arcsinh<T, dtype, decltype(policy)::value>(value); });
+        });
     }
 
     template <typename T, typename dtype = T>
     requires(is_real_v<T>)
-    array<dtype> arctan(const array<T>& x, out_t<dtype> out = none::out<dtype>, const where_t& where = none::where) {
-        return ufunc_unary(x, out, where, &math::arctan<T, dtype>);
+    array<dtype> arctan(const array<T>& x, out_t<dtype> out = none::out<dtype>, const where_t& where = none::where,
+                        const precision_t precision = precision_t::accurate) {
+        return detail::with_precision(precision, [&](auto policy) {
+            return ufunc_unary(x, out, where, [](const T& value) { return math::arctan<T, dtype, decltype(policy)::value>(value); });
+        });
     }
     template <typename dtype, typename T>
     requires(is_real_v<T>)
-    array<dtype> arctan(const array<T>& x, const where_t& where = none::where) {
-        return arctan(x, none::out<dtype>, where);
+    array<dtype> arctan(const array<T>& x, const where_t& where = none::where, const precision_t precision = precision_t::accurate) {
+        return arctan(x, none::out<dtype>, where, precision);
     }
     template <typename T, typename dtype = T>
     requires(is_real_v<T>)
-    array<dtype> arctan(const array<T>& x, const where_t& where) {
-        return arctan(x, none::out<dtype>, where);
+    array<dtype> arctan(const array<T>& x, const where_t& where, const precision_t precision = precision_t::accurate) {
+        return arctan(x, none::out<dtype>, where, precision);
+    }
+    template <typename G, typename dtype = typename G::value_type>
+    requires(is_lazy_v<G> && is_real_v<typename G::value_type>)
+    array<dtype> arctan(const G& x, out_t<dtype> out = none::out<dtype>, const where_t& where = none::where,
+                        const precision_t precision = precision_t::accurate) {
+        using T = typename G::value_type;
+        return detail::with_precision(precision, [&](auto policy) {
+            return ufunc_unary(x, out, where, [](const T& value) { return math::arctan<T, dtype, decltype(policy)::value>(value); });
+        });
     }
 
     template <typename T, typename U, typename dtype = promote_t<T, U>>
     requires(is_real_v<T> && is_real_v<U>)
-    array<dtype> arctan2(const array<T>& y, const array<U>& x, out_t<dtype> out = none::out<dtype>, const where_t& where = none::where) {
-        return ufunc_binary(y, x, out, where, &math::arctan2<T, U, dtype>);
+    array<dtype> arctan2(const array<T>& y, const array<U>& x, out_t<dtype> out = none::out<dtype>, const where_t& where = none::where,
+                         const precision_t precision = precision_t::accurate) {
+        return detail::with_precision(precision, [&](auto policy) {
+            return ufunc_binary(y, x, out, where,
+                                [](const T& a, const U& b) { return math::arctan2<T, U, dtype, decltype(policy)::value>(a, b); });
+        });
     }
     template <typename dtype, typename T, typename U>
     requires(is_real_v<T> && is_real_v<U>)
-    array<dtype> arctan2(const array<T>& y, const array<U>& x, const where_t& where = none::where) {
-        return arctan2(y, x, none::out<dtype>, where);
+    array<dtype> arctan2(const array<T>& y, const array<U>& x, const where_t& where = none::where,
+                         const precision_t precision = precision_t::accurate) {
+        return arctan2(y, x, none::out<dtype>, where, precision);
     }
     template <typename T, typename U, typename dtype = promote_t<T, U>>
     requires(is_real_v<T> && is_real_v<U>)
-    array<dtype> arctan2(const array<T>& y, const array<U>& x, const where_t& where) {
-        return arctan2(y, x, none::out<dtype>, where);
+    array<dtype> arctan2(const array<T>& y, const array<U>& x, const where_t& where, const precision_t precision = precision_t::accurate) {
+        return arctan2(y, x, none::out<dtype>, where, precision);
     }
 
     template <typename T, typename dtype = T>
     requires(is_real_v<T>)
-    array<dtype> arctanh(const array<T>& x, out_t<dtype> out = none::out<dtype>, const where_t& where = none::where) {
-        return ufunc_unary(x, out, where, &math::arctanh<T, dtype>);
+    array<dtype> arctanh(const array<T>& x, out_t<dtype> out = none::out<dtype>, const where_t& where = none::where,
+                         const precision_t precision = precision_t::accurate) {
+        return detail::with_precision(precision, [&](auto policy) {
+            return ufunc_unary(x, out, where, [](const T& value) { return math::arctanh<T, dtype, decltype(policy)::value>(value); });
+        });
     }
     template <typename dtype, typename T>
     requires(is_real_v<T>)
-    array<dtype> arctanh(const array<T>& x, const where_t& where = none::where) {
-        return arctanh(x, none::out<dtype>, where);
+    array<dtype> arctanh(const array<T>& x, const where_t& where = none::where, const precision_t precision = precision_t::accurate) {
+        return arctanh(x, none::out<dtype>, where, precision);
     }
     template <typename T, typename dtype = T>
     requires(is_real_v<T>)
-    array<dtype> arctanh(const array<T>& x, const where_t& where) {
-        return arctanh(x, none::out<dtype>, where);
+    array<dtype> arctanh(const array<T>& x, const where_t& where, const precision_t precision = precision_t::accurate) {
+        return arctanh(x, none::out<dtype>, where, precision);
+    }
+    template <typename G, typename dtype = typename G::value_type>
+    requires(is_lazy_v<G> && is_real_v<typename G::value_type>)
+    array<dtype> arctanh(const G& x, out_t<dtype> out = none::out<dtype>, const where_t& where = none::where,
+                         const precision_t precision = precision_t::accurate) {
+        using T = typename G::value_type;
+        return detail::with_precision(precision, [&](auto policy) {
+            return ufunc_unary(x, out, where, [](const T& value) { return math::arctanh<T, dtype, decltype(policy)::value>(value); });
+        });
     }
 
     template <typename T>
@@ -267,92 +440,83 @@ namespace numcpp {
     }
 
     template <typename T>
-    array<size_t> argpartition(const array<T>& a, const size_t kth, const int8_t axis = 1) {
-        auto [row, col] = a.shape();
-        array res(buffer_t<size_t>(row * col), {row, col});
+    array<size_t> argpartition(const array<T>& a, const size_t kth, const int8_t axis = -1) {
+        const shape_t shape = a.shape();
+        array res(buffer_t<size_t>(shape.size()), shape);
 
         if (axis == none::axis) {
-            if (kth >= row * col) {
-                throw std::invalid_argument("out of bounce");
-            }
-            res = res.reshape({1, row * col});
-            math::argpartition(res, a.reshape({1, row * col}), kth);
-        } else if (axis == 0 || axis == -2) {
-            if (kth >= row) {
+            if (kth >= shape.size()) {
                 throw std::invalid_argument("out of bounce");
             }
-            for (ll_t i = 0; i < col; i++) {
-                math::argpartition(res[{slice_t(), i}], a[{slice_t(), i}], kth);
-            }
-        } else if (axis == 1 || axis == -1) {
-            if (kth >= col) {
+            res = res.reshape(shape.size());
+            math::argpartition(res, a.ravel(), kth);
+        } else {
+            const size_t ax = detail::normalize_axis(axis, shape.ndim);
+
+            if (kth >= shape[ax]) {
                 throw std::invalid_argument("out of bounce");
             }
-            for (ll_t i = 0; i < row; i++) {
-                math::argpartition(res[i], a[i], kth);
-            }
-        } else {
-            throw std::invalid_argument("other axes are not suppoerted");
+            detail::for_each_lane(shape, ax, [&](const index_t& index, size_t) { math::argpartition(res[index], a[index], kth); });
         }
         return res;
     }
 
     template <typename T>
-    array<size_t> argsort(const array<T>& a, const int8_t axis = 1, const std::string& kind = "quicksort", const bool stable = false) {
-        auto [row, col] = a.shape();
-        array res(buffer_t<size_t>(row * col), {row, col});
+    array<size_t> argsort(const array<T>& a, const int8_t axis = -1, const std::string& kind = "quicksort", const bool stable = false) {
+        const shape_t shape = a.shape();
+        array res(buffer_t<size_t>(shape.size()), shape);
 
         if (axis == none::axis) {
-            res = res.reshape({1, row * col});
-            math::argsort(res, a.reshape({1, row * col}), kind, stable);
-        } else if (axis == 0 || axis == -2) {
-            for (ll_t i = 0; i < col; i++) {
-                math::argsort(res[{slice_t(), i}], a[{slice_t(), i}], kind, stable);
-            }
-        } else if (axis == 1 || axis == -1) {
-            for (ll_t i = 0; i < row; i++) {
-                math::argsort(res[i], a[i], kind, stable);
-            }
+            res = res.reshape(shape.size());
+            math::argsort(res, a.ravel(), kind, stable);
         } else {
-            throw std::invalid_argument("other axes are not suppoerted");
+            detail::for_each_lane(shape, detail::normalize_axis(axis, shape.ndim),
+                                  [&](const index_t& index, size_t) { math::argsort(res[index], a[index], kind, stable); });
         }
         return res;
     }
 
     template <typename T>
     array<size_t> argwhere(const array<T>& a) {
-        auto [row, col] = a.shape();
+        const shape_t shape = a.shape();
         const size_t size = a.size() - std::count(a.begin(), a.end(), T());
-        size_t k = 0;
+        size_t k = 0, i = 0;
         buffer_t<size_t> res;
 
         if (is_matrix(a)) {
-            res = buffer_t<size_t>(size * 2);
+            res = buffer_t<size_t>(size * shape.ndim);
 
-            for (ll_t i = 0; i < row; i++) {
-                for (ll_t j = 0; j < col; j++) {
-                    if (a[{i, j}]) {
-                        res[k++] = i;
-                        res[k++] = j;
+            for (const T& value : a) {
+                if (value) {
+                    for (size_t d = shape.ndim, rest = i; d-- > 0; rest /= shape[d]) {
+                        res[k + d] = rest % shape[d];
                     }
+                    k += shape.ndim;
                 }
+                i++;
             }
-            return array(std::move(res), {size, 2});
+            return array(std::move(res), {size, shape.ndim});
         }
         res = buffer_t<size_t>(size);
 
-        for (ll_t i = 0; i < col; i++) {
-            if (a[i]) {
+        for (const T& value : a) {
+            if (value) {
                 res[k++] = i;
             }
+            i++;
         }
         return array(std::move(res), size);
     }
 
     template <typename T, typename dtype = T>
-    array<dtype> around(const array<T>& a, const int8_t decimals = 0, out_t<dtype> = none::out<dtype>) {
-        // implementation of round()
-        return array<dtype>();
+    requires(is_numeric_v<T>)
+    array<dtype> around(const array<T>& a, const int8_t decimals = 0, out_t<dtype> out = none::out<dtype>) {
+        const float64_t factor = std::pow(10.0, std::abs(int(decimals)));
+
+        if (decimals < 0) {
+            return ufunc_unary(a, out, none::where, [factor](const T& x) { return math::around<T, dtype>(x, factor, true); });
+        }
+        return ufunc_unary(a, out, none::where, [factor](const T& x) { return math::around<T, dtype>(x, factor, false); });
     }
 
     template <typename T>
@@ -369,19 +533,23 @@ namespace numcpp {
     }
 
     template <typename T, typename U>
+    requires(is_numeric_v<T> && is_numeric_v<U>)
     bool array_equal(const array<T>& a1, const array<U>& a2, bool equal_nan = false) {
         if (a1.shape() != a2.shape()) {
             return false;
         }
-        return ufunc_axes_binary(a1, a2, none::axis, none::out<bool>, false, &math::equal<T, U>, equal_nan);
+        return ufunc_all_pairs(detail::as_operand(a1), detail::as_operand(a2),
+                               [equal_nan](const T& x, const U& y) { return math::equal(x, y, equal_nan); });
     }
 
+    // Equal after broadcasting the two arrays against each other; false when they do not broadcast.
     template <typename T, typename U>
+    requires(is_numeric_v<T> && is_numeric_v<U>)
     bool array_equiv(const array<T>& a1, const array<U>& a2) {
-        if (a1.shape() == a2.shape()) {
-            return array_equal(a1, a2);
+        if (!can_broadcast_shape(a1.shape(), a2.shape())) {
+            return false;
         }
-        return all(ufunc_binary(a1, a2, none::out<bool>, none::where, std::equal_to()));
+        return ufunc_all_pairs(detail::as_operand(a1), detail::as_operand(a2), [](const T& x, const U& y) { return math::equal(x, y, false); });
     }
 
     template <typename T>
@@ -389,10 +557,491 @@ namespace numcpp {
         return array2string(arr, max_line_width, precision, suppress_smail);
     }
 
+    template <typename T>
+    array<T> ascontiguousarray(const array<T>& a) {
+        if (is_contiguous(a.shape(), strides(a))) {
+            return a;
+        }
+        return a.copy();
+    }
+
+    template <typename T>
+    array<T> asfortranarray(const array<T>& a) {
+        if (is_contiguous(a.shape(), strides(a), order_t::F)) {
+            return a;
+        }
+        return a.copy(order_t::F);
+    }
+
+    // Number of occurrences of each value of the non-negative integers in x, over one bin past the largest and at least minlength.
+    template <typename T>
+    requires(std::is_integral_v<T> && !std::is_same_v<T, bool>)
+    array<int64_t> bincount(const array<T>& x, const size_t minlength = 0) {
+        const array<T> flat = ascontiguousarray(x);
+        const T* data = flat.data();
+
+        return ufunc_histogram<int64_t>(
+            flat.size(), sizeof(T), detail::bincount_shape(data, flat.size(), minlength),
+            [data](const size_t i, const size_t m, size_t* out) {
+                for (size_t j = 0; j < m; j++) {
+                    out[j] = size_t(data[i + j]);
+                }
+            },
+            [](size_t) { return int64_t(1); });
+    }
+    // Sum of the weights of the positions of each value of x, weights having the shape of x.
+    template <typename T, typename W>
+    requires(std::is_integral_v<T> && !std::is_same_v<T, bool> && is_real_v<W>)
+    array<float64_t> bincount(const array<T>& x, const array<W>& weights, const size_t minlength = 0) {
+        if (weights.shape() != x.shape()) {
+            throw std::invalid_argument("`weights` must have the shape of `x`");
+        }
+        const array<T> flat = ascontiguousarray(x);
+        const array<W> flat_weights = ascontiguousarray(weights);
+        const T* data = flat.data();
+        const W* w = flat_weights.data();
+
+        return ufunc_histogram<float64_t>(
+            flat.size(), sizeof(T) + sizeof(W), detail::bincount_shape(data, flat.size(), minlength),
+            [data](const size_t i, const size_t m, size_t* out) {
+                for (size_t j = 0; j < m; j++) {
+                    out[j] = size_t(data[i + j]);
+                }
+            },
+            [w](const size_t i) { return float64_t(w[i]); });
+    }
+
+    // Limits the values of a to [a_min, a_max], a NaN in a or in a bound giving NaN as in NumPy.
+    template <typename T, typename dtype = T>
+    requires(is_real_v<T>)
+    array<dtype> clip(const array<T>& a, const std::type_identity_t<T> a_min, const std::type_identity_t<T> a_max,
+                      out_t<dtype> out = none::out<dtype>, const where_t& where = none::where) {
+        // The bounds go in as prvalues: forwarded lvalues stay references, loads the vectorizer cannot hoist above the stores to out.
+        return ufunc_unary(
+            a, out, where, [](const T value, const T low, const T high) { return static_cast<dtype>(math::clip(value, low, high)); }, T(a_min),
+            T(a_max));
+    }
+    template <typename T, typename U, typename V, typename dtype = promote_t<T, promote_t<U, V>>>
+    requires(is_real_v<T> && is_real_v<U> && is_real_v<V>)
+    array<dtype> clip(const array<T>& a, const array<U>& a_min, const array<V>& a_max, out_t<dtype> out = none::out<dtype>,
+                      const where_t& where = none::where) {
+        return ufunc_ternary(a, a_min, a_max, out, where, [](const T value, const U low, const V high) {
+            return math::clip(static_cast<dtype>(value), static_cast<dtype>(low), static_cast<dtype>(high));
+        });
+    }
+
+    template <typename T, typename dtype = T>
+    requires(is_numeric_v<T>)
+    array<dtype> conj(const array<T>& x, out_t<dtype> out = none::out<dtype>, const where_t& where = none::where) {
+        return ufunc_unary(x, out, where, [](const T& value) { return math::conj<T, dtype>(value); });
+    }
+    template <typename T, typename dtype = T>
+    requires(is_numeric_v<T>)
+    array<dtype> conj(const array<T>& x, const where_t& where) {
+        return conj(x, none::out<dtype>, where);
+    }
+
+    template <typename T, typename dtype = T>
+    requires(is_numeric_v<T>)
+    array<dtype> conjugate(const array<T>& x, out_t<dtype> out = none::out<dtype>, const where_t& where = none::where) {
+        return conj(x, out, where);
+    }
+
+    template <typename T, typename dtype = T>
+    requires(is_real_v<T>)
+    array<dtype> cos(const array<T>& x, out_t<dtype> out = none::out<dtype>, const where_t& where = none::where,
+                     const precision_t precision = precision_t::accurate) {
+        return detail::with_precision(precision, [&](auto policy) {
+            return ufunc_unary(x, out, where, [](const T& value) { return math::cos<T, dtype, decltype(policy)::value>(value); });
+        });
+    }
+    template <typename dtype, typename T>
+    requires(is_real_v<T>)
+    array<dtype> cos(const array<T>& x, const where_t& where = none::where, const precision_t precision = precision_t::accurate) {
+        return cos(x, none::out<dtype>, where, precision);
+    }
+    template <typename T, typename dtype = T>
+    requires(is_real_v<T>)
+    array<dtype> cos(const array<T>& x, const where_t& where, const precision_t precision = precision_t::accurate) {
+        return cos(x, none::out<dtype>, where, precision);
+    }
+    template <typename G, typename dtype = typename G::value_type>
+    requires(is_lazy_v<G> && is_real_v<typename G::value_type>)
+    array<dtype> cos(const G& x, out_t<dtype> out = none::out<dtype>, const where_t& where = none::where,
+                     const precision_t precision = precision_t::accurate) {
+        using T = typename G::value_type;
+        return detail::with_precision(precision, [&](auto policy) {
+            return ufunc_unary(x, out, where, [](const T& value) { return math::cos<T, dtype, decltype(policy)::value>(value); });
+        });
+    }
+
+    template <typename T, typename dtype = T>
+    requires(is_real_v<T>)
+    array<dtype> cosh(const array<T>& x, out_t<dtype> out = none::out<dtype>, const where_t& where = none::where,
+                      const precision_t precision = precision_t::accurate) {
+        return detail::with_precision(precision, [&](auto policy) {
+            return ufunc_unary(x, out, where, [](const T& value) { return math::cosh<T, dtype, decltype(policy)::value>(value); });
+        });
+    }
+    template <typename dtype, typename T>
+    requires(is_real_v<T>)
+    array<dtype> cosh(const array<T>& x, const where_t& where = none::where, const precision_t precision = precision_t::accurate) {
+        return cosh(x, none::out<dtype>, where, precision);
+    }
+    template <typename T, typename dtype = T>
+    requires(is_real_v<T>)
+    array<dtype> cosh(const array<T>& x, const where_t& where, const precision_t precision = precision_t::accurate) {
+        return cosh(x, none::out<dtype>, where, precision);
+    }
+    template <typename G, typename dtype = typename G::value_type>
+    requires(is_lazy_v<G> && is_real_v<typename G::value_type>)
+    array<dtype> cosh(const G& x, out_t<dtype> out = none::out<dtype>, const where_t& where = none::where,
+                      const precision_t precision = precision_t::accurate) {
+        using T = typename G::value_type;
+        return detail::with_precision(precision, [&](auto policy) {
+            return ufunc_unary(x, out, where, [](const T& value) { return math::cosh<T, dtype, decltype(policy)::value>(value); });
+        });
+    }
+
+    template <typename T, typename dtype = ll_t>
+    requires(is_numeric_v<T>)
+    array<dtype> count_nonzero(const array<T>& a, const int8_t axis = none::axis, const bool keepdims = false) {
+        return ufunc_reduce(a, axis, none::out<dtype>, keepdims, none::where, detail::nonzero_reducer_t<dtype>());
+    }
+    inline size_t count_nonzero(const bitmask_t& mask) noexcept { return mask.count(); }
+
+    // Running maximum along axis that propagates NaN, of the flattened array for none::axis.
+    template <typename T>
+    requires(is_real_v<T>)
+    array<T> cummax(const array<T>& a, const int8_t axis = none::axis, out_t<T> out = none::out<T>) {
+        return ufunc_accumulate(a, axis, out, detail::maximum());
+    }
+
+    template <typename T>
+    requires(is_real_v<T>)
+    array<T> cummin(const array<T>& a, const int8_t axis = none::axis, out_t<T> out = none::out<T>) {
+        return ufunc_accumulate(a, axis, out, detail::minimum());
+    }
+
+    template <typename T, typename dtype = sum_t<T>>
+    requires(is_numeric_v<T>)
+    array<dtype> cumprod(const array<T>& a, const int8_t axis = none::axis, out_t<dtype> out = none::out<dtype>) {
+        return ufunc_accumulate(a, axis, out, std::multiplies<dtype>());
+    }
+    template <typename dtype, typename T>
+    requires(is_numeric_v<T>)
+    array<dtype> cumprod(const array<T>& a, const int8_t axis = none::axis) {
+        return cumprod(a, axis, none::out<dtype>);
+    }
+
+    // Running sum along axis, of the flattened array for none::axis, accumulated in the dtype of sum.
+    template <typename T, typename dtype = sum_t<T>>
+    requires(is_numeric_v<T>)
+    array<dtype> cumsum(const array<T>& a, const int8_t axis = none::axis, out_t<dtype> out = none::out<dtype>) {
+        return ufunc_accumulate(a, axis, out, std::plus<dtype>());
+    }
+    template <typename dtype, typename T>
+    requires(is_numeric_v<T>)
+    array<dtype> cumsum(const array<T>& a, const int8_t axis = none::axis) {
+        return cumsum(a, axis, none::out<dtype>);
+    }
+
+    template <typename T, typename dtype = T>
+    requires(is_numeric_v<T>)
+    array<dtype> exp(const array<T>& x, out_t<dtype> out = none::out<dtype>, const where_t& where = none::where,
+                     const precision_t precision = precision_t::accurate) {
+        return detail::with_precision(precision, [&](auto policy) {
+            return ufunc_unary(x, out, where, [](const T& value) { return math::exp<T, dtype, decltype(policy)::value>(value); });
+        });
+    }
+    template <typename dtype, typename T>
+    requires(is_numeric_v<T>)
+    array<dtype> exp(const array<T>& x, const where_t& where = none::where, const precision_t precision = precision_t::accurate) {
+        return exp(x, none::out<dtype>, where, precision);
+    }
+    template <typename T, typename dtype = T>
+    requires(is_numeric_v<T>)
+    array<dtype> exp(const array<T>& x, const where_t& where, const precision_t precision = precision_t::accurate) {
+        return exp(x, none::out<dtype>, where, precision);
+    }
+
+    // Counts of the flattened a in `bins` bins of equal width over [lo, hi], with their bins + 1 edges. Samples outside the range are
+    // left out and the last bin includes hi.
+    template <typename T, typename E = std::conditional_t<is_floating_point_v<T>, T, float64_t>>
+    requires(is_real_v<T>)
+    std::pair<array<int64_t>, array<E>> histogram(const array<T>& a, const size_t bins, const std::type_identity_t<E> lo,
+                                                  const std::type_identity_t<E> hi) {
+        const array<T> flat = ascontiguousarray(a);
+        const T* data = flat.data();
+        const detail::uniform_bins_t<E> bin(bins, lo, hi);
+
+        return {ufunc_histogram<int64_t>(
+                    flat.size(), sizeof(T), shape_t(bins), [&](const size_t i, const size_t m, size_t* out) { bin(data + i, m, out); },
+                    [](size_t) { return int64_t(1); }),
+                bin.edges};
+    }
+    // Over the range of a, widened by a half on either side when all its values are equal.
+    template <typename T, typename E = std::conditional_t<is_floating_point_v<T>, T, float64_t>>
+    requires(is_real_v<T>)
+    std::pair<array<int64_t>, array<E>> histogram(const array<T>& a, const size_t bins = 10) {
+        const array<T> flat = ascontiguousarray(a);
+        const auto [lo, hi] = detail::sample_range<E>(flat.data(), flat.size());
+        return histogram<T, E>(flat, bins, lo, hi);
+    }
+    // Counts between consecutive edges of the increasing `bins`, the last bin including its right edge.
+    template <typename T, typename E>
+    requires(is_real_v<T> && is_floating_point_v<E>)
+    array<int64_t> histogram(const array<T>& a, const array<E>& bins) {
+        const array<T> flat = ascontiguousarray(a);
+        const T* data = flat.data();
+        const detail::edge_bins_t<E> bin(bins);
+
+        return ufunc_histogram<int64_t>(
+            flat.size(), sizeof(T), shape_t(bin.bins), [&](const size_t i, const size_t m, size_t* out) { bin(data + i, m, out); },
+            [](size_t) { return int64_t(1); });
+    }
+
+    // Counts of the sample pairs (x[i], y[i]) in a bins by bins grid, each axis split evenly over the range of its samples, with the
+    // edges of the x and the y bins; result[i, j] counts the pairs with x in bin i and y in bin j.
+    template <typename T, typename E = std::conditional_t<is_floating_point_v<T>, T, float64_t>>
+    requires(is_real_v<T>)
+    std::tuple<array<int64_t>, array<E>, array<E>> histogram2d(const array<T>& x, const array<T>& y, const size_t bins = 10) {
+        if (x.size() != y.size()) {
+            throw std::invalid_argument("`x` and `y` must have the same number of samples");
+        }
+        const array<T> xs = ascontiguousarray(x), ys = ascontiguousarray(y);
+        const auto [x_lo, x_hi] = detail::sample_range<E>(xs.data(), xs.size());
+        const auto [y_lo, y_hi] = detail::sample_range<E>(ys.data(), ys.size());
+        const detail::uniform_bins_t<E> x_bin(bins, x_lo, x_hi), y_bin(bins, y_lo, y_hi);
+        return {detail::histogram2d(xs, ys, x_bin, y_bin), x_bin.edges, y_bin.edges};
+    }
+    // Between consecutive edges of the increasing x_edges and y_edges.
+    template <typename T, typename E>
+    requires(is_real_v<T> && is_floating_point_v<E>)
+    array<int64_t> histogram2d(const array<T>& x, const array<T>& y, const array<E>& x_edges, const array<E>& y_edges) {
+        if (x.size() != y.size()) {
+            throw std::invalid_argument("`x` and `y` must have the same number of samples");
+        }
+        const detail::edge_bins_t<E> x_bin(x_edges), y_bin(y_edges);
+        return detail::histogram2d(ascontiguousarray(x), ascontiguousarray(y), x_bin, y_bin);
+    }
+
+    template <typename T, typename dtype = T>
+    requires(is_real_v<T>)
+    array<dtype> log(const array<T>& x, out_t<dtype> out = none::out<dtype>, const where_t& where = none::where,
+                     const precision_t precision = precision_t::accurate) {
+        return detail::with_precision(precision, [&](auto policy) {
+            return ufunc_unary(x, out, where, [](const T& value) { return math::log<T, dtype, decltype(policy)::value>(value); });
+        });
+    }
+    template <typename dtype, typename T>
+    requires(is_real_v<T>)
+    array<dtype> log(const array<T>& x, const where_t& where = none::where, const precision_t precision = precision_t::accurate) {
+        return log(x, none::out<dtype>, where, precision);
+    }
+    template <typename T, typename dtype = T>
+    requires(is_real_v<T>)
+    array<dtype> log(const array<T>& x, const where_t& where, const precision_t precision = precision_t::accurate) {
+        return log(x, none::out<dtype>, where, precision);
+    }
+    template <typename G, typename dtype = typename G::value_type>
+    requires(is_lazy_v<G> && is_real_v<typename G::value_type>)
+    array<dtype> log(const G& x, out_t<dtype> out = none::out<dtype>, const where_t& where = none::where,
+                     const precision_t precision = precision_t::accurate) {
+        using T = typename G::value_type;
+        return detail::with_precision(precision, [&](auto policy) {
+            return ufunc_unary(x, out, where, [](const T& value) { return math::log<T, dtype, decltype(policy)::value>(value); });
+        });
+    }
+
+    template <typename T, typename dtype = mean_t<T>>
+    requires(is_numeric_v<T>)
+    array<dtype> mean(const array<T>& a, const int8_t axis = none::axis, out_t<dtype> out = none::out<dtype>, const bool keepdims = false,
+                      const where_t& where = none::where, const summation_t summation = summation_t::pairwise) {
+        array<dtype> res = sum(a, axis, out, keepdims, dtype(0), where, summation);
+        // Divides in place in *out itself: res is a copy of it, which writing to would detach under copy-on-write.
+        array<dtype>& target = out ? *out : res;
+
+        if (where) {
+            const array<dtype> count = ufunc_reduce(a, axis, none::out<dtype>, keepdims, where, detail::count_reducer_t<dtype>());
+            return ufunc_binary(target, count, out_t<dtype>(target), none::where, detail::divides());
+        }
+        const dtype count = dtype(a.size() / std::max<size_t>(target.size(), 1));
+        return ufunc_unary(target, out_t<dtype>(target), none::where, [count](const dtype& x) { return x / count; });
+    }
+    template <typename dtype, typename T>
+    requires(is_numeric_v<T>)
+    array<dtype> mean(const array<T>& a, const int8_t axis = none::axis, const bool keepdims = false, const where_t& where = none::where,
+                      const summation_t summation = summation_t::pairwise) {
+        return mean(a, axis, none::out<dtype>, keepdims, where, summation);
+    }
+    template <typename T>
+    requires(is_numeric_v<T>)
+    array<mean_t<T>> mean(const array<T>& a, const int8_t axis, const bool keepdims, const where_t& where = none::where,
+                          const summation_t summation = summation_t::pairwise) {
+        return mean(a, axis, none::out<mean_t<T>>, keepdims, where, summation);
+    }
+
+    // Replaces NaN with nan and infinities with posinf and neginf, by default the largest and lowest finite values; out_t(x) replaces in
+    // place as NumPy's copy=False does.
+    template <typename T>
+    requires(is_numeric_v<T>)
+    array<T> nan_to_num(const array<T>& x, out_t<T> out = none::out<T>, const real_t<T> nan = 0,
+                        const real_t<T> posinf = std::numeric_limits<real_t<T>>::max(),
+                        const real_t<T> neginf = std::numeric_limits<real_t<T>>::lowest()) {
+        using R = real_t<T>;
+        return ufunc_unary(
+            x, out, none::where, [](const T value, const R fill, const R high, const R low) { return math::nan_to_num(value, fill, high, low); },
+            R(nan), R(posinf), R(neginf));
+    }
+    template <typename T>
+    requires(is_numeric_v<T>)
+    array<T> nan_to_num(const array<T>& x, const real_t<T> nan, const real_t<T> posinf = std::numeric_limits<real_t<T>>::max(),
+                        const real_t<T> neginf = std::numeric_limits<real_t<T>>::lowest()) {
+        return nan_to_num(x, none::out<T>, nan, posinf, neginf);
+    }
+
+    // Packs the elements of a along axis, of the flattened array for none::axis, into bytes eight at a time, the last byte padded with
+    // zeros. With bitorder "big" the first element of each byte lands in its most significant bit.
+    template <typename T>
+    requires(is_integral_v<T>)
+    array<uint8_t> packbits(const array<T>& a, const int8_t axis = none::axis, const std::string& bitorder = "big") {
+        if (bitorder != "big" && bitorder != "little") {
+            throw std::invalid_argument("'bitorder' must be either 'little' or 'big'");
+        }
+        const array<T> src = axis == none::axis ? a.ravel() : a;
+        const shape_t shape = src.shape();
+        const size_t ax = axis == none::axis ? shape.ndim - 1 : detail::normalize_axis(axis, shape.ndim), n = shape[ax];
+        const bool big = bitorder == "big";
+        shape_t res_shape = shape, lane_shape = shape;
+        res_shape[ax] = (n + 7) / 8;
+        lane_shape[ax] = 1;
+        array<uint8_t> result(buffer_t<uint8_t>(res_shape.size()), res_shape);
+        uint8_t* res = result.data();
+        const T* ptr = src.data();
+        const ll_t src_step = strides(src)[ax], res_step = strides(result)[ax];
+
+        detail::strided_loop<2>(lane_shape, {strides(src), strides(result)}, [&](const auto& pos, const size_t len, const auto& step) {
+            for (size_t k = 0; k < len; k++) {
+                const T* lane = ptr + pos[0] + ll_t(k) * step[0];
+                uint8_t* bytes = res + pos[1] + ll_t(k) * step[1];
+
+                for (size_t i = 0; i < n; i += 8) {
+                    uint8_t byte = 0;
+
+                    for (size_t j = 0; j < std::min<size_t>(8, n - i); j++) {
+                        byte |= uint8_t(lane[ll_t(i + j) * src_step] != T(0)) << (big ? 7 - j : j);
+                    }
+                    bytes[ll_t(i / 8) * res_step] = byte;
+                }
+            }
+        });
+        return result;
+    }
+    // The flattened bits of mask, which are already packed in little bit order.
+    inline array<uint8_t> packbits(const bitmask_t& mask, const std::string& bitorder = "big") {
+        if (bitorder != "big" && bitorder != "little") {
+            throw std::invalid_argument("'bitorder' must be either 'little' or 'big'");
+        }
+        const size_t n = (mask.size() + 7) / 8;
+        const uint64_t* words = mask.words();
+        array<uint8_t> result(buffer_t<uint8_t>(n), n);
+        uint8_t* res = result.data();
+
+        for (size_t i = 0; i < n; i++) {
+            uint8_t byte = uint8_t(words[i / 8] >> (i % 8 * 8));
+
+            if (bitorder == "big") {
+                byte = uint8_t((byte & 0xF0) >> 4 | (byte & 0x0F) << 4);
+                byte = uint8_t((byte & 0xCC) >> 2 | (byte & 0x33) << 2);
+                byte = uint8_t((byte & 0xAA) >> 1 | (byte & 0x55) << 1);
+            }
+            res[i] = byte;
+        }
+        return result;
+    }
+
+    template <typename T, typename U, typename dtype = promote_t<T, U>>
+    requires(is_real_v<T> && is_real_v<U>)
+    array<dtype> power(const array<T>& x, const array<U>& y, out_t<dtype> out = none::out<dtype>, const where_t& where = none::where,
+                       const precision_t precision = precision_t::accurate) {
+        return detail::with_precision(precision, [&](auto policy) {
+            return ufunc_binary(x, y, out, where,
+                                [](const T& a, const U& b) { return math::power<T, U, dtype, decltype(policy)::value>(a, b); });
+        });
+    }
+    template <typename dtype, typename T, typename U>
+    requires(is_real_v<T> && is_real_v<U>)
+    array<dtype> power(const array<T>& x, const array<U>& y, const where_t& where = none::where,
+                       const precision_t precision = precision_t::accurate) {
+        return power(x, y, none::out<dtype>, where, precision);
+    }
+    template <typename T, typename U, typename dtype = promote_t<T, U>>
+    requires(is_real_v<T> && is_real_v<U>)
+    array<dtype> power(const array<T>& x, const array<U>& y, const where_t& where, const precision_t precision = precision_t::accurate) {
+        return power(x, y, none::out<dtype>, where, precision);
+    }
+
+    template <typename T, typename U, typename dtype = promote_t<T, U>>
+    requires(is_real_v<T> && is_real_v<U>)
+    array<dtype> pow(const array<T>& x, const array<U>& y, out_t<dtype> out = none::out<dtype>, const where_t& where = none::where,
+                     const precision_t precision = precision_t::accurate) {
+        return power(x, y, out, where, precision);
+    }
+    template <typename dtype, typename T, typename U>
+    requires(is_real_v<T> && is_real_v<U>)
+    array<dtype> pow(const array<T>& x, const array<U>& y, const where_t& where = none::where, const precision_t precision = precision_t::accurate) {
+        return power<dtype>(x, y, where, precision);
+    }
+    template <typename T, typename U, typename dtype = promote_t<T, U>>
+    requires(is_real_v<T> && is_real_v<U>)
+    array<dtype> pow(const array<T>& x, const array<U>& y, const where_t& where, const precision_t precision = precision_t::accurate) {
+        return power(x, y, where, precision);
+    }
+
+    template <typename T, typename dtype = sum_t<T>>
+    requires(is_numeric_v<T>)
+    array<dtype> prod(const array<T>& a, const int8_t axis = none::axis, out_t<dtype> out = none::out<dtype>, const bool keepdims = false,
+                      const dtype initial = dtype(1), const where_t& where = none::where) {
+        return ufunc_reduce(a, axis, out, keepdims, where, detail::reducer_t{std::multiplies<dtype>(), dtype(1), initial});
+    }
+    template <typename dtype, typename T>
+    requires(is_numeric_v<T>)
+    array<dtype> prod(const array<T>& a, const int8_t axis = none::axis, const bool keepdims = false,
+                      const std::type_identity_t<dtype> initial = dtype(1), const where_t& where = none::where) {
+        return prod(a, axis, none::out<dtype>, keepdims, initial, where);
+    }
+    template <typename T>
+    requires(is_numeric_v<T>)
+    array<sum_t<T>> prod(const array<T>& a, const int8_t axis, const bool keepdims, const sum_t<T> initial = sum_t<T>(1),
+                         const where_t& where = none::where) {
+        return prod(a, axis, none::out<sum_t<T>>, keepdims, initial, where);
+    }
+
+    // Writes values into the flattened a at indices in turn, so the last write to a repeated index wins; values shorter than indices
+    // are repeated.
+    template <typename T, typename U>
+    void put(array<T>& a, const array<ll_t>& indices, const array<U>& values) {
+        const detail::gather_plan_t plan = detail::gather_plan(a, indices, none::axis);
+        const array<U> flat = is_contiguous(values.shape(), strides(values)) ? values : values.copy();
+        const size_t count = plan.base.size, n = flat.size();
+
+        if (n == 0) {
+            return;
+        }
+        T* dst = a.data();
+        const U* src = flat.data();
+        const ll_t* base = plan.base.data();
+
+        for (size_t i = 0, k = 0; i < count; i++, k = k + 1 == n ? 0 : k + 1) {
+            dst[base[i]] = static_cast<T>(src[k]);
+        }
+    }
+
     template <typename T, typename dtype = T>
     requires(is_real_v<T>)
     array<dtype> rad2deg(const array<T>& x, out_t<dtype> out = none::out<dtype>, const where_t& where = none::where) {
-        return ufunc_unary(x, out, where, &math::rad2deg<T, dtype>);
+        return ufunc_unary(x, out, where, [](const T& value) { return math::rad2deg<T, dtype>(value); });
     }
     template <typename dtype, typename T>
     requires(is_real_v<T>)
@@ -404,17 +1053,314 @@ namespace numcpp {
     array<dtype> rad2deg(const array<T>& x, const where_t& where) {
         return rad2deg(x, none::out<dtype>, where);
     }
+    template <typename G, typename dtype = typename G::value_type>
+    requires(is_lazy_v<G> && is_real_v<typename G::value_type>)
+    array<dtype> rad2deg(const G& x, out_t<dtype> out = none::out<dtype>, const where_t& where = none::where) {
+        using T = typename G::value_type;
+        return ufunc_unary(x, out, where, [](const T& value) { return math::rad2deg<T, dtype>(value); });
+    }
+
+    // a[indices] += values with every repeat of an index adding, as np.add.at; ufunc_scatter describes the parallel paths.
+    template <typename T, typename U>
+    void scatter_add(array<T>& a, const array<ll_t>& indices, const array<U>& values, const int8_t axis = none::axis) {
+        ufuncs::add.at(a, indices, values, axis);
+    }
+    template <typename T>
+    void scatter_add(array<T>& a, const array<ll_t>& indices, const std::type_identity_t<T> value, const int8_t axis = none::axis) {
+        ufuncs::add.at(a, indices, value, axis);
+    }
+
+    template <typename T, typename dtype = T>
+    requires(is_real_v<T>)
+    array<dtype> sin(const array<T>& x, out_t<dtype> out = none::out<dtype>, const where_t& where = none::where,
+                     const precision_t precision = precision_t::accurate) {
+        return detail::with_precision(precision, [&](auto policy) {
+            return ufunc_unary(x, out, where, [](const T& value) { return math::sin<T, dtype, decltype(policy)::value>(value); });
+        });
+    }
+    template <typename dtype, typename T>
+    requires(is_real_v<T>)
+    array<dtype> sin(const array<T>& x, const where_t& where = none::where, const precision_t precision = precision_t::accurate) {
+        return sin(x, none::out<dtype>, where, precision);
+    }
+    template <typename T, typename dtype = T>
+    requires(is_real_v<T>)
+    array<dtype> sin(const array<T>& x, const where_t& where, const precision_t precision = precision_t::accurate) {
+        return sin(x, none::out<dtype>, where, precision);
+    }
+    template <typename G, typename dtype = typename G::value_type>
+    requires(is_lazy_v<G> && is_real_v<typename G::value_type>)
+    array<dtype> sin(const G& x, out_t<dtype> out = none::out<dtype>, const where_t& where = none::where,
+                     const precision_t precision = precision_t::accurate) {
+        using T = typename G::value_type;
+        return detail::with_precision(precision, [&](auto policy) {
+            return ufunc_unary(x, out, where, [](const T& value) { return math::sin<T, dtype, decltype(policy)::value>(value); });
+        });
+    }
+
+    template <typename T, typename dtype = T>
+    requires(is_real_v<T>)
+    array<dtype> sinh(const array<T>& x, out_t<dtype> out = none::out<dtype>, const where_t& where = none::where,
+                      const precision_t precision = precision_t::accurate) {
+        return detail::with_precision(precision, [&](auto policy) {
+            return ufunc_unary(x, out, where, [](const T& value) { return math::sinh<T, dtype, decltype(policy)::value>(value); });
+        });
+    }
+    template <typename dtype, typename T>
+    requires(is_real_v<T>)
+    array<dtype> sinh(const array<T>& x, const where_t& where = none::where, const precision_t precision = precision_t::accurate) {
+        return sinh(x, none::out<dtype>, where, precision);
+    }
+    template <typename T, typename dtype = T>
+    requires(is_real_v<T>)
+    array<dtype> sinh(const array<T>& x, const where_t& where, const precision_t precision = precision_t::accurate) {
+        return sinh(x, none::out<dtype>, where, precision);
+    }
+    template <typename G, typename dtype = typename G::value_type>
+    requires(is_lazy_v<G> && is_real_v<typename G::value_type>)
+    array<dtype> sinh(const G& x, out_t<dtype> out = none::out<dtype>, const where_t& where = none::where,
+                      const precision_t precision = precision_t::accurate) {
+        using T = typename G::value_type;
+        return detail::with_precision(precision, [&](auto policy) {
+            return ufunc_unary(x, out, where, [](const T& value) { return math::sinh<T, dtype, decltype(policy)::value>(value); });
+        });
+    }
+
+    // Standard deviation, named stddev because a function called std would collide with namespace std under `using namespace numcpp`.
+    template <typename T, typename dtype = mean_t<T>>
+    requires(is_real_v<T>)
+    array<dtype> stddev(const array<T>& a, const int8_t axis = none::axis, out_t<dtype> out = none::out<dtype>, const size_t ddof = 0,
+                        const bool keepdims = false, const where_t& where = none::where) {
+        return ufunc_reduce(a, axis, out, keepdims, where, detail::moments_t<dtype>{.ddof = dtype(ddof), .root = true});
+    }
+    template <typename dtype, typename T>
+    requires(is_real_v<T>)
+    array<dtype> stddev(const array<T>& a, const int8_t axis = none::axis, const size_t ddof = 0, const bool keepdims = false,
+                        const where_t& where = none::where) {
+        return stddev(a, axis, none::out<dtype>, ddof, keepdims, where);
+    }
+    template <typename T>
+    requires(is_real_v<T>)
+    array<mean_t<T>> stddev(const array<T>& a, const int8_t axis, const size_t ddof, const bool keepdims = false,
+                            const where_t& where = none::where) {
+        return stddev(a, axis, none::out<mean_t<T>>, ddof, keepdims, where);
+    }
+
+    // Integer sums are exact; floating-point ones are pairwise, or also compensated with summation_t::compensated.
+    template <typename T, typename dtype = sum_t<T>>
+    requires(is_numeric_v<T>)
+    array<dtype> sum(const array<T>& a, const int8_t axis = none::axis, out_t<dtype> out = none::out<dtype>, const bool keepdims = false,
+                     const dtype initial = dtype(0), const where_t& where = none::where, const summation_t summation = summation_t::pairwise) {
+        if constexpr (!is_integral_v<dtype>) {
+            if (summation == summation_t::compensated) {
+                return ufunc_reduce(a, axis, out, keepdims, where, detail::compensated_sum_t<dtype>{.initial = {initial, dtype(0)}});
+            }
+        }
+        return ufunc_reduce(a, axis, out, keepdims, where, detail::reducer_t{std::plus<dtype>(), dtype(0), initial});
+    }
+    template <typename dtype, typename T>
+    requires(is_numeric_v<T>)
+    array<dtype> sum(const array<T>& a, const int8_t axis = none::axis, const bool keepdims = false,
+                     const std::type_identity_t<dtype> initial = dtype(0), const where_t& where = none::where,
+                     const summation_t summation = summation_t::pairwise) {
+        return sum(a, axis, none::out<dtype>, keepdims, initial, where, summation);
+    }
+    template <typename T>
+    requires(is_numeric_v<T>)
+    array<sum_t<T>> sum(const array<T>& a, const int8_t axis, const bool keepdims, const sum_t<T> initial = sum_t<T>(0),
+                        const where_t& where = none::where, const summation_t summation = summation_t::pairwise) {
+        return sum(a, axis, none::out<sum_t<T>>, keepdims, initial, where, summation);
+    }
+
+    template <typename T, typename dtype = T>
+    requires(is_real_v<T>)
+    array<dtype> tan(const array<T>& x, out_t<dtype> out = none::out<dtype>, const where_t& where = none::where,
+                     const precision_t precision = precision_t::accurate) {
+        return detail::with_precision(precision, [&](auto policy) {
+            return ufunc_unary(x, out, where, [](const T& value) { return math::tan<T, dtype, decltype(policy)::value>(value); });
+        });
+    }
+    template <typename dtype, typename T>
+    requires(is_real_v<T>)
+    array<dtype> tan(const array<T>& x, const where_t& where = none::where, const precision_t precision = precision_t::accurate) {
+        return tan(x, none::out<dtype>, where, precision);
+    }
+    template <typename T, typename dtype = T>
+    requires(is_real_v<T>)
+    array<dtype> tan(const array<T>& x, const where_t& where, const precision_t precision = precision_t::accurate) {
+        return tan(x, none::out<dtype>, where, precision);
+    }
+    template <typename G, typename dtype = typename G::value_type>
+    requires(is_lazy_v<G> && is_real_v<typename G::value_type>)
+    array<dtype> tan(const G& x, out_t<dtype> out = none::out<dtype>, const where_t& where = none::where,
+                     const precision_t precision = precision_t::accurate) {
+        using T = typename G::value_type;
+        return detail::with_precision(precision, [&](auto policy) {
+            return ufunc_unary(x, out, where, [](const T& value) { return math::tan<T, dtype, decltype(policy)::value>(value); });
+        });
+    }
+
+    template <typename T, typename dtype = T>
+    requires(is_real_v<T>)
+    array<dtype> tanh(const array<T>& x, out_t<dtype> out = none::out<dtype>, const where_t& where = none::where,
+                      const precision_t precision = precision_t::accurate) {
+        return detail::with_precision(precision, [&](auto policy) {
+            return ufunc_unary(x, out, where, [](const T& value) { return math::tanh<T, dtype, decltype(policy)::value>(value); });
+        });
+    }
+    template <typename dtype, typename T>
+    requires(is_real_v<T>)
+    array<dtype> tanh(const array<T>& x, const where_t& where = none::where, const precision_t precision = precision_t::accurate) {
+        return tanh(x, none::out<dtype>, where, precision);
+    }
+    template <typename T, typename dtype = T>
+    requires(is_real_v<T>)
+    array<dtype> tanh(const array<T>& x, const where_t& where, const precision_t precision = precision_t::accurate) {
+        return tanh(x, none::out<dtype>, where, precision);
+    }
+    template <typename G, typename dtype = typename G::value_type>
+    requires(is_lazy_v<G> && is_real_v<typename G::value_type>)
+    array<dtype> tanh(const G& x, out_t<dtype> out = none::out<dtype>, const where_t& where = none::where,
+                      const precision_t precision = precision_t::accurate) {
+        using T = typename G::value_type;
+        return detail::with_precision(precision, [&](auto policy) {
+            return ufunc_unary(x, out, where, [](const T& value) { return math::tanh<T, dtype, decltype(policy)::value>(value); });
+        });
+    }
+
+    // Elements of a at indices, of the flattened array for none::axis and whole slabs along axis otherwise, shaped as a with that axis
+    // replaced by the count of indices; negative indices count from the end.
+    template <typename T>
+    array<T> take(const array<T>& a, const array<ll_t>& indices, const int8_t axis = none::axis, out_t<T> out = none::out<T>) {
+        return ufunc_gather(a, indices, axis, out);
+    }
+
+    // The element of arr along axis at each of indices, which has the dimensions of arr and broadcasts against it on the other axes, so
+    // that the result of argsort along axis sorts arr. none::axis takes from the flattened arr.
+    template <typename T, typename I>
+    requires(std::is_integral_v<I> && !std::is_same_v<I, bool>)
+    array<T> take_along_axis(const array<T>& arr, const array<I>& indices, const int8_t axis) {
+        if (axis == none::axis) {
+            return take_along_axis(arr.ravel(), indices, -1);
+        }
+        const shape_t arr_shape = arr.shape(), idx_shape = indices.shape();
+
+        if (arr_shape.ndim != idx_shape.ndim) {
+            throw std::invalid_argument("`indices` and `arr` must have the same number of dimensions");
+        }
+        const size_t ax = detail::normalize_axis(axis, arr_shape.ndim), dim = arr_shape[ax];
+        shape_t lane_shape = arr_shape;
+        lane_shape[ax] = 1;
+        const shape_t res_shape = broadcast_shape(lane_shape, idx_shape);
+        const ll_t step = strides(arr)[ax];
+        array<T> result(buffer_t<T>(res_shape.size()), res_shape);
+        T* res = result.data();
+        const T* src = arr.data();
+        const I* idx = indices.data();
+
+        detail::strided_loop<3>(res_shape,
+                                {strides(result), detail::broadcast_strides(idx_shape, strides(indices), res_shape),
+                                 detail::broadcast_strides(lane_shape, strides(arr), res_shape)},
+                                [&](const auto& pos, const size_t n, const auto& steps) {
+                                    for (size_t k = 0; k < n; k++) {
+                                        const ll_t index = ll_t(idx[pos[1] + ll_t(k) * steps[1]]), j = index < 0 ? index + ll_t(dim) : index;
+
+                                        if (j < 0 || j >= ll_t(dim)) {
+                                            throw std::out_of_range("index " + std::to_string(index) + " is out of bounds for size " +
+                                                                    std::to_string(dim));
+                                        }
+                                        res[pos[0] + ll_t(k) * steps[0]] = src[pos[2] + ll_t(k) * steps[2] + j * step];
+                                    }
+                                });
+        return result;
+    }
+
+    // Inverse of packbits: the bits of each byte of a along axis, of the flattened array for none::axis, as 0 or 1. count keeps that
+    // many of them, padding with zeros past the last byte; none::size keeps them all.
+    inline array<uint8_t> unpackbits(const array<uint8_t>& a, const int8_t axis = none::axis, const size_t count = none::size,
+                                     const std::string& bitorder = "big") {
+        if (bitorder != "big" && bitorder != "little") {
+            throw std::invalid_argument("'bitorder' must be either 'little' or 'big'");
+        }
+        const array<uint8_t> src = axis == none::axis ? a.ravel() : a;
+        const shape_t shape = src.shape();
+        const size_t ax = axis == none::axis ? shape.ndim - 1 : detail::normalize_axis(axis, shape.ndim), n = shape[ax] * 8;
+        const bool big = bitorder == "big";
+        shape_t res_shape = shape, lane_shape = shape;
+        res_shape[ax] = count == none::size ? n : count;
+        lane_shape[ax] = 1;
+        array<uint8_t> result(buffer_t<uint8_t>(res_shape.size()), res_shape);
+        uint8_t* res = result.data();
+        const uint8_t* ptr = src.data();
+        const ll_t src_step = strides(src)[ax], res_step = strides(result)[ax];
+        const size_t m = std::min(n, res_shape[ax]);
+
+        detail::strided_loop<2>(lane_shape, {strides(src), strides(result)}, [&](const auto& pos, const size_t len, const auto& step) {
+            for (size_t k = 0; k < len; k++) {
+                const uint8_t* bytes = ptr + pos[0] + ll_t(k) * step[0];
+                uint8_t* lane = res + pos[1] + ll_t(k) * step[1];
+
+                for (size_t i = 0; i < m; i++) {
+                    lane[ll_t(i) * res_step] = (bytes[ll_t(i / 8) * src_step] >> (big ? 7 - i % 8 : i % 8)) & 1;
+                }
+            }
+        });
+        return result;
+    }
+
+    template <typename T, typename dtype = mean_t<T>>
+    requires(is_real_v<T>)
+    array<dtype> var(const array<T>& a, const int8_t axis = none::axis, out_t<dtype> out = none::out<dtype>, const size_t ddof = 0,
+                     const bool keepdims = false, const where_t& where = none::where) {
+        return ufunc_reduce(a, axis, out, keepdims, where, detail::moments_t<dtype>{.ddof = dtype(ddof)});
+    }
+    template <typename dtype, typename T>
+    requires(is_real_v<T>)
+    array<dtype> var(const array<T>& a, const int8_t axis = none::axis, const size_t ddof = 0, const bool keepdims = false,
+                     const where_t& where = none::where) {
+        return var(a, axis, none::out<dtype>, ddof, keepdims, where);
+    }
+    template <typename T>
+    requires(is_real_v<T>)
+    array<mean_t<T>> var(const array<T>& a, const int8_t axis, const size_t ddof, const bool keepdims = false, const where_t& where = none::where) {
+        return var(a, axis, none::out<mean_t<T>>, ddof, keepdims, where);
+    }
+
+    // Elements of x where condition is nonzero and of y elsewhere, the three broadcast together and selected by a branch-free blend. A scalar
+    // x or y takes the type of the array it is paired with.
+    template <typename C, typename T, typename U, typename dtype = promote_t<T, U>>
+    array<dtype> where(const array<C>& condition, const array<T>& x, const array<U>& y, out_t<dtype> out = none::out<dtype>) {
+        return ufunc_ternary(condition, x, y, out, none::where, [](const C test, const T left, const U right) {
+            return detail::blend(test != C(), static_cast<dtype>(left), static_cast<dtype>(right));
+        });
+    }
+    template <typename C, typename T>
+    array<T> where(const array<C>& condition, const array<T>& x, const std::type_identity_t<T> y, out_t<T> out = none::out<T>) {
+        return ufunc_binary(
+            condition, x, out, none::where, [](const C test, const T left, const T right) { return detail::blend(test != C(), left, right); }, T(y));
+    }
+    template <typename C, typename T>
+    array<T> where(const array<C>& condition, const std::type_identity_t<T> x, const array<T>& y, out_t<T> out = none::out<T>) {
+        return ufunc_binary(
+            condition, y, out, none::where, [](const C test, const T right, const T left) { return detail::blend(test != C(), left, right); }, T(x));
+    }
+    template <typename C, typename T>
+    requires(is_numeric_v<T>)
+    array<T> where(const array<C>& condition, const T x, const std::type_identity_t<T> y, out_t<T> out = none::out<T>) {
+        return where(condition, array<T>(x), array<T>(y), out);
+    }
 
     template <typename T, typename dtype = T>
     requires(is_real_v<T>)
     array<dtype> floor(const array<T>& arr, out_t<dtype> out = none::out<dtype>, const where_t& where = none::where) {
-        return ufunc(arr, out, where, &math::floor<T, dtype>);
+        return ufunc_unary(arr, out, where, [](const T& value) { return math::floor<T, dtype>(value); });
     }
     template <typename dtype, typename T>
     requires(is_real_v<T>)
     array<dtype> floor(const array<T>& arr, const where_t& where = none::where) {
         return floor(arr, none::out<dtype>, where);
     }
+
     template <typename T, typename dtype = T>
     requires(is_real_v<T>)
     array<dtype> floor(const array<T>& arr, const where_t& where) {
@@ -0,0 +1,100 @@
+#pragma once
+#include <atomic>
+#include <cfenv>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace numcpp {
+    // Splitting of parallel reductions: fast merges per-thread partial results as threads finish, deterministic folds fixed blocks of the
+    // input into partials merged by a fixed pairwise tree, so that results are bit-identical whatever the thread count. The extra merge
+    // pass only applies above 4 MiB of input; see reduce/sum_det in the benchmarks for its cost.
+    enum class reduction_mode_t : uint8_t { fast, deterministic };
+
+    namespace detail {
+        inline std::atomic<size_t> num_threads = 0;
+        inline std::atomic<reduction_mode_t> reduction_mode = reduction_mode_t::fast;
+        inline thread_local bool in_parallel = false;
+    } // namespace detail
+
+    // Upper bound on the threads used by parallel kernels; 0 restores the default of one per hardware thread.
+    inline void set_num_threads(const size_t n) noexcept { detail::num_threads.store(n, std::memory_order_relaxed); }
+
+    inline size_t get_num_threads() noexcept {
+        const size_t n = detail::num_threads.load(std::memory_order_relaxed);
+        return n ? n : std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    inline void set_reduction_mode(const reduction_mode_t mode) noexcept { detail::reduction_mode.store(mode, std::memory_order_relaxed); }
+
+    inline reduction_mode_t get_reduction_mode() noexcept { return detail::reduction_mode.load(std::memory_order_relaxed); }
+
+    namespace detail {
+        // Splits [0, n) into contiguous chunks of at least `grain` items and calls body(begin, end) once per chunk, the last chunk on the
+        // calling thread. Nested calls run serially and the first exception thrown by any chunk is rethrown after all chunks finish.
+        // Floating-point exception flags and profile counters of worker threads are merged into the calling thread's.
+        template <typename Body>
+        void parallel_for(const size_t n, const size_t grain, Body body) {
+            const size_t chunks = in_parallel ? 1 : std::min(get_num_threads(), n / std::max<size_t>(grain, 1));
+
+            if (chunks <= 1) {
+                if (n) {
+                    body(size_t(0), n);
+                }
+                return;
+            }
+            std::vector<std::thread> workers;
+            std::exception_ptr error;
+            std::mutex mutex;
+            std::atomic<int> raised = 0;
+            NUMCPP_PROFILE_JOIN(profiled);
+            auto run = [&](const size_t begin, const size_t end) {
+                const bool nested = std::exchange(in_parallel, true);
+
+                try {
+                    body(begin, end);
+                } catch (...) {
+                    const std::lock_guard lock(mutex);
+
+                    if (!error) {
+                        error = std::current_exception();
+                    }
+                }
+                in_parallel = nested;
+            };
+            workers.reserve(chunks - 1);
+
+            for (size_t i = 0; i + 1 < chunks; i++) {
+                try {
+                    workers.emplace_back(
+                        [&](const size_t begin, const size_t end) {
+                            std::feclearexcept(FE_ALL_EXCEPT);
+                            NUMCPP_PROFILE_WORKER(profiled);
+                            run(begin, end);
+                            raised.fetch_or(std::fetestexcept(FE_DIVBYZERO | FE_OVERFLOW | FE_UNDERFLOW | FE_INVALID), std::memory_order_relaxed);
+                        },
+                        n * i / chunks, n * (i + 1) / chunks);
+                } catch (const std::system_error&) {
+                    run(n * i / chunks, n * (i + 1) / chunks);
+                }
+            }
+            run(n * (chunks - 1) / chunks, n);
+
+            for (std::thread& worker : workers) {
+                worker.join();
+            }
+            NUMCPP_PROFILE_MERGE(profiled);
+
+            if (const int flags = raised.load(std::memory_order_relaxed)) {
+                std::feraiseexcept(flags);
+            }
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+    } // namespace detail
+} // namespace numcpp
@@ -0,0 +1,338 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <utility>
+
+// Hooks are compiled in only with NUMCPP_PROFILE defined and record only while profile::enable() is active.
+#ifdef NUMCPP_PROFILE
+#define NUMCPP_PROFILE_SCOPE(id, elements, bytes_read, bytes_written)                                                                               \
+    const ::numcpp::profile::scope_t numcpp_profile_scope(::numcpp::profile::kernel::id, elements, bytes_read, bytes_written)
+#define NUMCPP_PROFILE_ALLOCATION(bytes) ::numcpp::profile::record_allocation(bytes)
+#define NUMCPP_PROFILE_JOIN(name) ::numcpp::profile::join_t name
+#define NUMCPP_PROFILE_WORKER(join) const ::numcpp::profile::join_t::worker_t numcpp_profile_worker(join)
+#define NUMCPP_PROFILE_MERGE(join) join.merge()
+#else
+#define NUMCPP_PROFILE_SCOPE(id, elements, bytes_read, bytes_written)
+#define NUMCPP_PROFILE_ALLOCATION(bytes)
+#define NUMCPP_PROFILE_JOIN(name)
+#define NUMCPP_PROFILE_WORKER(join)
+#define NUMCPP_PROFILE_MERGE(join)
+#endif
+
+namespace numcpp::profile {
+#ifdef NUMCPP_PROFILE
+    inline constexpr bool compiled = true;
+#else
+    inline constexpr bool compiled = false;
+#endif
+
+    enum class kernel : uint8_t {
+        ufunc_unary,
+        ufunc_binary,
+        ufunc_ternary,
+        ufunc_axes_unary,
+        ufunc_axes_binary,
+        ufunc_reduce,
+        ufunc_accumulate,
+        ufunc_nary,
+        ufunc_all_pairs,
+        ufunc_gather,
+        ufunc_scatter,
+        ufunc_histogram,
+        binary_opr_broadcast,
+        binary_opr_element_wise,
+        unary_opr_element_wise,
+        count
+    };
+
+    inline constexpr const char* kernel_names[] = {"ufunc_unary",          "ufunc_binary",            "ufunc_ternary",
+                                                   "ufunc_axes_unary",     "ufunc_axes_binary",       "ufunc_reduce",
+                                                   "ufunc_accumulate",     "ufunc_nary",              "ufunc_all_pairs",
+                                                   "ufunc_gather",         "ufunc_scatter",           "ufunc_histogram",
+                                                   "binary_opr_broadcast", "binary_opr_element_wise", "unary_opr_element_wise"};
+
+    struct counters_t {
+        uint64_t calls = 0, elements = 0, bytes_read = 0, bytes_written = 0, nanoseconds = 0, temporaries = 0;
+
+        constexpr counters_t& operator+=(const counters_t& other) noexcept {
+            calls += other.calls;
+            elements += other.elements;
+            bytes_read += other.bytes_read;
+            bytes_written += other.bytes_written;
+            nanoseconds += other.nanoseconds;
+            temporaries += other.temporaries;
+            return *this;
+        }
+        constexpr counters_t& operator-=(const counters_t& other) noexcept {
+            calls -= other.calls;
+            elements -= other.elements;
+            bytes_read -= other.bytes_read;
+            bytes_written -= other.bytes_written;
+            nanoseconds -= other.nanoseconds;
+            temporaries -= other.temporaries;
+            return *this;
+        }
+    };
+
+    struct report_t {
+        counters_t kernels[size_t(kernel::count)];
+        uint64_t allocations = 0, allocated_bytes = 0;
+        std::map<std::string, counters_t> regions;
+
+        constexpr const counters_t& operator[](const kernel id) const noexcept { return kernels[size_t(id)]; }
+
+        report_t& operator+=(const report_t& other) noexcept {
+            for (size_t i = 0; i < size_t(kernel::count); i++) {
+                kernels[i] += other.kernels[i];
+            }
+            allocations += other.allocations;
+            allocated_bytes += other.allocated_bytes;
+            return *this;
+        }
+        report_t& operator-=(const report_t& other) noexcept {
+            for (size_t i = 0; i < size_t(kernel::count); i++) {
+                kernels[i] -= other.kernels[i];
+            }
+            allocations -= other.allocations;
+            allocated_bytes -= other.allocated_bytes;
+            return *this;
+        }
+
+        friend std::ostream& operator<<(std::ostream& out, const report_t& report) {
+            auto row = [&out](const std::string& name, const counters_t& c) {
+                out << std::left << std::setw(26) << name << std::right << std::setw(10) << c.calls << std::setw(14) << c.elements << std::setw(14)
+                    << c.bytes_read << std::setw(14) << c.bytes_written << std::setw(14) << c.nanoseconds / 1000 << std::setw(12) << c.temporaries
+                    << '\n';
+            };
+            out << std::left << std::setw(26) << "kernel" << std::right << std::setw(10) << "calls" << std::setw(14) << "elements" << std::setw(14)
+                << "bytes_read" << std::setw(14) << "bytes_written" << std::setw(14) << "time_us" << std::setw(12) << "temporaries" << '\n';
+
+            for (size_t i = 0; i < size_t(kernel::count); i++) {
+                if (report.kernels[i].calls) {
+                    row(kernel_names[i], report.kernels[i]);
+                }
+            }
+            for (const auto& [name, counters] : report.regions) {
+                row("region:" + name, counters);
+            }
+            return out << "allocations: " << report.allocations << " (" << report.allocated_bytes << " bytes)" << std::endl;
+        }
+    };
+
+    namespace detail {
+        enum field : uint8_t { calls, elements, bytes_read, bytes_written, nanoseconds, temporaries, field_count };
+
+        // Written only by the owning thread, read by report() from any thread.
+        struct thread_counters_t {
+            std::atomic<uint64_t> values[size_t(kernel::count)][field_count] = {};
+            std::atomic<uint64_t> allocations = 0, allocated_bytes = 0;
+            thread_counters_t* next = nullptr;
+
+            static void add(std::atomic<uint64_t>& counter, const uint64_t value) noexcept {
+                counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+            }
+
+            report_t snapshot() const noexcept {
+                report_t res;
+
+                for (size_t i = 0; i < size_t(kernel::count); i++) {
+                    counters_t& c = res.kernels[i];
+                    c.calls = values[i][field::calls].load(std::memory_order_relaxed);
+                    c.elements = values[i][field::elements].load(std::memory_order_relaxed);
+                    c.bytes_read = values[i][field::bytes_read].load(std::memory_order_relaxed);
+                    c.bytes_written = values[i][field::bytes_written].load(std::memory_order_relaxed);
+                    c.nanoseconds = values[i][field::nanoseconds].load(std::memory_order_relaxed);
+                    c.temporaries = values[i][field::temporaries].load(std::memory_order_relaxed);
+                }
+                res.allocations = allocations.load(std::memory_order_relaxed);
+                res.allocated_bytes = allocated_bytes.load(std::memory_order_relaxed);
+                return res;
+            }
+        };
+
+        inline std::atomic<bool> active = false;
+        inline std::atomic<thread_counters_t*> head = nullptr;
+        inline thread_local kernel current = kernel::count;
+
+        inline std::mutex regions_mutex;
+        inline std::map<std::string, counters_t> regions;
+        inline report_t baseline;
+
+        // Counters of the parallel_for workers this thread has joined, which its regions count as its own.
+        inline thread_local report_t joined;
+
+        // Linked on the thread's first record. Counters of exited threads stay linked so their totals remain in the report.
+        inline thread_local thread_counters_t* own = nullptr;
+
+        inline thread_counters_t& local() noexcept {
+            if (!own) {
+                own = new thread_counters_t();
+                own->next = head.load(std::memory_order_relaxed);
+
+                while (!head.compare_exchange_weak(own->next, own, std::memory_order_release, std::memory_order_relaxed)) {}
+            }
+            return *own;
+        }
+
+        // Counters of the current thread, without linking any for a thread that has recorded nothing.
+        inline report_t snapshot() noexcept { return own ? own->snapshot() : report_t(); }
+
+        inline report_t total() noexcept {
+            report_t res;
+
+            for (const thread_counters_t* node = head.load(std::memory_order_acquire); node; node = node->next) {
+                res += node->snapshot();
+            }
+            return res;
+        }
+
+        inline report_t attributed() noexcept {
+            report_t res = snapshot();
+            res += joined;
+            return res;
+        }
+
+        inline uint64_t now() noexcept {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+        }
+    } // namespace detail
+
+    inline void enable(const bool on = true) noexcept { detail::active.store(on, std::memory_order_relaxed); }
+    inline void disable() noexcept { enable(false); }
+    inline bool enabled() noexcept { return compiled && detail::active.load(std::memory_order_relaxed); }
+
+    inline report_t report() {
+        report_t res = detail::total();
+        const std::lock_guard lock(detail::regions_mutex);
+        res -= detail::baseline;
+        res.regions = detail::regions;
+        return res;
+    }
+
+    inline void reset() {
+        const report_t res = detail::total();
+        const std::lock_guard lock(detail::regions_mutex);
+        detail::baseline = res;
+        detail::regions.clear();
+    }
+
+    inline void record_allocation(const uint64_t bytes) noexcept {
+        if (enabled()) {
+            detail::thread_counters_t& counters = detail::local();
+            detail::thread_counters_t::add(counters.allocations, 1);
+            detail::thread_counters_t::add(counters.allocated_bytes, bytes);
+
+            if (detail::current != kernel::count) {
+                detail::thread_counters_t::add(counters.values[size_t(detail::current)][detail::temporaries], 1);
+            }
+        }
+    }
+
+    class scope_t {
+        kernel id, parent = kernel::count;
+        uint64_t start = 0;
+        bool on;
+
+    public:
+        scope_t(const kernel id, const uint64_t elements, const uint64_t bytes_read, const uint64_t bytes_written) noexcept : id(id), on(enabled()) {
+            if (on) {
+                std::atomic<uint64_t>* values = detail::local().values[size_t(id)];
+                detail::thread_counters_t::add(values[detail::calls], 1);
+                detail::thread_counters_t::add(values[detail::elements], elements);
+                detail::thread_counters_t::add(values[detail::bytes_read], bytes_read);
+                detail::thread_counters_t::add(values[detail::bytes_written], bytes_written);
+                parent = std::exchange(detail::current, id);
+                start = detail::now();
+            }
+        }
+        scope_t(const scope_t&) = delete;
+        scope_t& operator=(const scope_t&) = delete;
+
+        ~scope_t() {
+            if (on) {
+                detail::thread_counters_t::add(detail::local().values[size_t(id)][detail::nanoseconds], detail::now() - start);
+                detail::current = parent;
+            }
+        }
+    };
+
+    // Sums the counters of the workers of one parallel_for, as they run, and merges them into the calling thread at the join. Workers
+    // record their temporaries against the kernel the calling thread is in.
+    class join_t {
+        std::mutex mutex;
+        report_t sum;
+        kernel parent = detail::current;
+        bool on = enabled();
+
+    public:
+        class worker_t {
+            join_t& join;
+            report_t start;
+            kernel previous = kernel::count;
+
+        public:
+            explicit worker_t(join_t& join) noexcept : join(join) {
+                if (join.on) {
+                    start = detail::snapshot();
+                    previous = std::exchange(detail::current, join.parent);
+                }
+            }
+            worker_t(const worker_t&) = delete;
+            worker_t& operator=(const worker_t&) = delete;
+
+            ~worker_t() {
+                if (join.on) {
+                    detail::current = previous;
+                    report_t delta = detail::snapshot();
+                    delta -= start;
+                    const std::lock_guard lock(join.mutex);
+                    join.sum += delta;
+                }
+            }
+        };
+
+        void merge() noexcept {
+            if (on) {
+                detail::joined += sum;
+            }
+        }
+    };
+
+    // Attributes the kernel work done by the current thread while alive, and by the parallel_for workers it joins, to a named region
+    // of the report.
+    class region_t {
+        std::string name;
+        report_t start;
+        uint64_t start_ns = 0;
+        bool on;
+
+    public:
+        explicit region_t(std::string name) : name(std::move(name)), on(enabled()) {
+            if (on) {
+                start = detail::attributed();
+                start_ns = detail::now();
+            }
+        }
+        region_t(const region_t&) = delete;
+        region_t& operator=(const region_t&) = delete;
+
+        ~region_t() {
+            if (on) {
+                const uint64_t elapsed = detail::now() - start_ns;
+                report_t delta = detail::attributed();
+                delta -= start;
+                counters_t res{1, 0, 0, 0, elapsed, delta.allocations};
+
+                for (const counters_t& c : delta.kernels) {
+                    res.elements += c.elements;
+                    res.bytes_read += c.bytes_read;
+                    res.bytes_written += c.bytes_written;
+                }
+                const std::lock_guard lock(detail::regions_mutex);
+                detail::regions[name] += res;
+            }
+        }
+    };
+} // namespace numcpp::profile
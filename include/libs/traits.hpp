@@ -34,6 +34,11 @@ namespace numcpp {
     using complex128_t = complex_t<double>;
     using complex256_t = complex_t<long double>;
 
+    template <typename>
+    struct range_t;
+    template <typename>
+    struct space_t;
+
     using str = std::string;
 
     using ll_t = long long;
@@ -72,6 +77,11 @@ namespace numcpp {
     template <typename T> struct is_numeric : std::bool_constant<is_integral_v<T> || is_floating_point_v<T> || is_complex_v<T>> {};
     template <typename T> inline constexpr bool is_numeric_v = is_numeric<T>::value;
 
+    template <typename> struct is_lazy : std::false_type {};
+    template <typename T> struct is_lazy<range_t<T>> : std::true_type {};
+    template <typename T> struct is_lazy<space_t<T>> : std::true_type {};
+    template <typename T> inline constexpr bool is_lazy_v = is_lazy<T>::value;
+
     template <typename T, bool = is_complex_v<T>> struct real_type { using type = T; };
     template <typename T> struct real_type<T, true> { using type = typename T::value_type;};
     template <typename T> using real_t = typename real_type<T>::type;
@@ -165,4 +175,13 @@ namespace numcpp {
 
     template <typename L, typename R, typename Operation = none_t<>>
     using promote_t = typename promote<L, R, Operation>::type;
+
+    // Result type of sum and prod, as in NumPy: booleans and narrower integers accumulate in 64 bits.
+    template <typename T>
+    using sum_t = std::conditional_t<is_integral_v<T> && sizeof(T) < 8,
+                                     std::conditional_t<std::is_unsigned_v<T> && !std::is_same_v<T, bool>, uint64_t, int64_t>, T>;
+
+    // Result type of mean, var and std: integers are averaged in float64.
+    template <typename T>
+    using mean_t = std::conditional_t<is_integral_v<T>, float64_t, T>;
 } // namespace numcpp
\ No newline at end of file
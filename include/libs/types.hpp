@@ -3,15 +3,13 @@
 namespace numcpp {
     template <typename T>
     class array;
+    template <typename T>
+    class array_builder;
+    class bitmask_t;
 
     size_t broadcast_index(size_t, size_t) noexcept;
     template <typename T>
-    std::string format(const T&, int equal_decimals) noexcept;
-
-    namespace detail {
-        template <typename T>
-        constexpr T division_by_zero_warning(T, const char[]) noexcept;
-    } // namespace detail
+    std::string format(const T&, int equal_decimals = -1) noexcept;
 
     template <typename T>
     struct complex_t {
@@ -30,22 +28,20 @@ namespace numcpp {
         constexpr complex_t operator*(const complex_t& other) const noexcept {
             return complex_t(real * other.real - imag * other.imag, real * other.imag + imag * other.real);
         }
+        // Smith's algorithm, which avoids overflow of |other|^2. The cases are chosen with selects instead of branches, so loops over
+        // interleaved complex arrays still vectorize.
         constexpr complex_t operator/(const complex_t& other) const noexcept {
-            T denominator = other.real * other.real + other.imag * other.imag;
-
-            if (!denominator) {
-                return detail::division_by_zero_warning(*this, __PRETTY_FUNCTION__);
-            }
-            return complex_t((real * other.real + imag * other.imag) / denominator, (imag * other.real - real * other.imag) / denominator);
+            const bool wide = std::isgreaterequal(std::abs(other.real), std::abs(other.imag));
+            const T big = wide ? other.real : other.imag, small = wide ? other.imag : other.real;
+            const T ratio = small / big, denominator = big + small * ratio;
+            return complex_t((wide ? real + imag * ratio : real * ratio + imag) / denominator,
+                             (wide ? imag - real * ratio : imag * ratio - real) / denominator);
         }
 
         constexpr complex_t operator+(const T value) const noexcept { return complex_t(real + value, imag); }
         constexpr complex_t operator-(const T value) const noexcept { return complex_t(real - value, imag); }
         constexpr complex_t operator*(const T value) const noexcept { return complex_t(real * value, imag * value); }
         constexpr complex_t operator/(const T value) const noexcept {
-            if (value == T()) {
-                return detail::division_by_zero_warning(*this, __PRETTY_FUNCTION__);
-            }
             return complex_t(real / value, imag / value);
         }
 
@@ -63,10 +59,7 @@ namespace numcpp {
         }
         template <typename V>
         friend constexpr complex_t operator/(const V& value, const complex_t& comp) noexcept {
-            if (comp == 0) {
-                return detail::division_by_zero_warning(value, __PRETTY_FUNCTION__);
-            }
-            return complex_t(value / comp.real, value / comp.imag);
+            return complex_t(T(value), 0) / comp;
         }
 
         constexpr complex_t& operator+=(const complex_t& other) noexcept {
@@ -85,18 +78,7 @@ namespace numcpp {
             imag = i;
             return *this;
         }
-        constexpr complex_t& operator/=(const complex_t& other) noexcept {
-            T denominator = other.real * other.real + other.imag * other.imag;
-
-            if (!denominator) {
-                return detail::division_by_zero_warning(*this, __PRETTY_FUNCTION__);
-            }
-            T r = (real * other.real + imag * other.imag) / denominator;
-            T i = (imag * other.real - real * other.imag) / denominator;
-            real = r;
-            imag = i;
-            return *this;
-        }
+        constexpr complex_t& operator/=(const complex_t& other) noexcept { return *this = *this / other; }
 
         constexpr complex_t& operator+=(const T value) noexcept {
             real += value;
@@ -112,9 +94,6 @@ namespace numcpp {
             return *this;
         }
         constexpr complex_t& operator/=(T value) noexcept {
-            if (value == T()) {
-                return detail::division_by_zero_warning(*this, __PRETTY_FUNCTION__);
-            }
             real /= value;
             imag /= value;
             return *this;
@@ -124,7 +103,18 @@ namespace numcpp {
         constexpr bool operator!=(const complex_t& other) const noexcept { return !(*this == other); }
         constexpr operator bool() const noexcept { return real != 0 || imag != 0; }
 
-        constexpr T abs() const noexcept { return std::sqrt(norm()); }
+        // Scaled by the larger component like std::hypot so that it neither overflows nor underflows, but branch free. Non-finite
+        // components are replaced before the arithmetic so they raise no spurious floating-point exceptions.
+        constexpr T abs() const noexcept {
+            constexpr T infinity = std::numeric_limits<T>::infinity();
+            const T x = std::abs(real), y = std::abs(imag);
+            const bool is_inf = x == infinity || y == infinity, is_nan = x != x || y != y;
+            const T fx = is_inf || is_nan ? T() : x, fy = is_inf || is_nan ? T() : y;
+            const T big = std::max(fx, fy), ratio = std::min(fx, fy) / (big + T(big == T()));
+            const T res = big * std::sqrt(T(1) + ratio * ratio);
+            return is_inf ? infinity : is_nan ? std::numeric_limits<T>::quiet_NaN() : res;
+        }
+        constexpr T arg() const noexcept { return std::atan2(imag, real); }
         constexpr complex_t conj() const noexcept { return complex_t(real, -imag); }
         constexpr T norm() const noexcept { return real * real + imag * imag; }
         constexpr std::complex<T> to_std() const noexcept { return std::complex<T>(real, imag); }
@@ -136,54 +126,144 @@ namespace numcpp {
         }
     };
 
+    // Arrays of complex_t are interleaved (real, imag) pairs, which the real()/imag() views and the vectorized kernels rely on.
+    static_assert(sizeof(complex_t<float>) == 2 * sizeof(float) && sizeof(complex_t<double>) == 2 * sizeof(double));
+
+    // Owned storage comes from one allocation that holds the shared_ptr control block next to the elements, so a scalar or a small
+    // result costs a single call to the allocator.
     template <typename T>
     class buffer_t {
-        std::shared_ptr<T[]> value;
+        template <typename>
+        friend class buffer_t;
+
+        mutable std::shared_ptr<T[]> value;
+        mutable std::shared_ptr<void> writers;
+        mutable T* ptr = nullptr;
+
+        static std::shared_ptr<T[]> allocate(const size_t n) {
+            NUMCPP_PROFILE_ALLOCATION(n * sizeof(T));
+            return std::make_shared_for_overwrite<T[]>(n);
+        }
+
+        void copy_storage() const {
+            std::shared_ptr<T[]> storage = allocate(size);
+            std::copy_n(ptr, size, storage.get());
+            value = std::move(storage);
+            ptr = value.get();
+            writers = nullptr;
+        }
 
     public:
         size_t size = 0;
 
         constexpr buffer_t() noexcept = default;
-        constexpr buffer_t(const buffer_t&) noexcept = default;
-        constexpr buffer_t(buffer_t&&) noexcept = default;
+        buffer_t(const buffer_t& other) noexcept : value(other.value), ptr(other.ptr), size(other.size) {}
+        buffer_t(buffer_t&& other) noexcept :
+            value(std::move(other.value)), writers(std::move(other.writers)), ptr(std::exchange(other.ptr, nullptr)),
+            size(std::exchange(other.size, 0)) {}
 
         explicit buffer_t(const size_t n) {
             if (n) {
+                value = allocate(n);
+                ptr = value.get();
                 size = n;
-                value = std::shared_ptr<T[]>(new T[size](), std::default_delete<T[]>());
-            } else {
-                value = nullptr;
+                std::fill_n(ptr, size, T());
             }
         }
-        buffer_t(const T* ptr, const size_t n) {
+        buffer_t(const T* data, const size_t n) {
             if (n) {
+                value = allocate(n);
+                ptr = value.get();
                 size = n;
-                value = std::shared_ptr<T[]>(new T[size], std::default_delete<T[]>());
-                std::copy_n(ptr, size, value.get());
-            } else {
-                value = nullptr;
+                std::copy_n(data, size, ptr);
             }
         }
         constexpr buffer_t(T* raw_ptr, const size_t n, std::nullptr_t) noexcept {
             if (n) {
                 size = n;
-                value = std::shared_ptr<T[]>(raw_ptr, [](T*) {});
-            } else {
-                value = nullptr;
+                ptr = raw_ptr;
             }
         }
+        // Adopting constructors take ownership of existing storage without copying its elements.
+        explicit buffer_t(std::vector<T>&& vec) requires(!std::is_same_v<T, bool>)
+        {
+            auto holder = std::make_shared<std::vector<T>>(std::move(vec));
+            size = holder->size();
+            value = std::shared_ptr<T[]>(holder, holder->data());
+            ptr = value.get();
+        }
+        buffer_t(std::unique_ptr<T[]>&& data, const size_t n) : value(std::move(data)), ptr(value.get()), size(n) {}
+        template <typename Deleter>
+        requires(std::is_invocable_v<Deleter&, T*>)
+        buffer_t(T* raw_ptr, const size_t n, Deleter deleter) : value(raw_ptr, std::move(deleter)), ptr(raw_ptr), size(n) {}
+
+        buffer_t& operator=(const buffer_t& other) noexcept {
+            value = other.value;
+            writers = nullptr;
+            ptr = other.ptr;
+            size = other.size;
+            return *this;
+        }
+        buffer_t& operator=(buffer_t&& other) noexcept {
+            if (this != &other) {
+                value = std::move(other.value);
+                writers = std::move(other.writers);
+                ptr = std::exchange(other.ptr, nullptr);
+                size = std::exchange(other.size, 0);
+            }
+            return *this;
+        }
+        constexpr operator bool() const noexcept { return ptr != nullptr; }
 
-        constexpr buffer_t& operator=(const buffer_t&) noexcept = default;
-        constexpr buffer_t& operator=(buffer_t&&) noexcept = default;
-        constexpr operator bool() const noexcept { return static_cast<bool>(value); }
+        // Copy-on-write owners of the same storage hold one token, plain copies (views) hold none.
+        size_t count_writers() const noexcept { return writers.use_count(); }
 
-        constexpr T& operator[](const size_t i) noexcept { return value[i]; }
-        constexpr const T& operator[](const size_t i) const noexcept { return value[i]; }
+        // Called on a fresh copy of owner: joins its copy-on-write owners, unless views also reference the storage, as they do when it
+        // has more references than writers. Writes through a view would reach every owner, so this copy takes private storage instead.
+        void share_writes(const buffer_t& owner) {
+            if (value.use_count() > std::max(owner.writers.use_count(), 1l) + 1) {
+                copy_storage();
+                return;
+            }
+            if (!owner.writers) {
+                owner.writers = std::make_shared<char>();
+            }
+            writers = owner.writers;
+        }
 
-        constexpr T* data() noexcept { return value.get(); }
-        constexpr const T* data() const noexcept { return value.get(); }
+        // Moves to private storage when another owner still shares it, leaving views on the old storage.
+        void detach() const {
+            if (writers.use_count() > 1) {
+                copy_storage();
+            }
+        }
+
+        // Shares the storage, reference count included, as elements of type V, so views of a complex buffer's parts count as views.
+        template <typename V>
+        buffer_t<V> alias_as(const size_t n) const noexcept {
+            buffer_t<V> res;
+            res.value = std::shared_ptr<V[]>(value, reinterpret_cast<V*>(ptr));
+            res.ptr = reinterpret_cast<V*>(ptr);
+            res.size = n;
+            return res;
+        }
+
+        constexpr T& operator[](const size_t i) noexcept { return ptr[i]; }
+        constexpr const T& operator[](const size_t i) const noexcept { return ptr[i]; }
+
+        constexpr T* data() noexcept { return ptr; }
+        constexpr const T* data() const noexcept { return ptr; }
     };
 
+    namespace detail {
+        inline std::atomic<bool> copy_on_write = false;
+    } // namespace detail
+
+    // With copy-on-write on, copying an array that owns its data shares the buffer until one of the copies is first written to.
+    inline void set_copy_on_write(const bool on = true) noexcept { detail::copy_on_write.store(on, std::memory_order_relaxed); }
+
+    inline bool get_copy_on_write() noexcept { return detail::copy_on_write.load(std::memory_order_relaxed); }
+
     class slice_t {
         bool resolved = false;
 
@@ -232,21 +312,90 @@ namespace numcpp {
     };
 
     struct shape_t {
-        size_t rows, cols;
+        static constexpr size_t max_ndim = 8;
+        size_t dims[max_ndim] = {};
+        uint8_t ndim = 2;
 
-        constexpr shape_t() noexcept : shape_t(0, 0) {}
+        constexpr shape_t() noexcept = default;
         constexpr shape_t(const size_t col) noexcept : shape_t(1, col) {}
-        constexpr shape_t(const size_t rows, const size_t cols) noexcept : rows(rows), cols(cols) {}
+        constexpr shape_t(const size_t rows, const size_t cols) noexcept : dims{rows, cols} {}
+        constexpr shape_t(const std::initializer_list<size_t> list) : shape_t(list.begin(), list.size()) {}
+        constexpr shape_t(const size_t* first, const size_t n) {
+            if (n > max_ndim) {
+                throw std::invalid_argument("maximum supported dimension for an array is 8");
+            }
+            ndim = std::max<size_t>(n, 2);
+            std::fill_n(dims, ndim - n, 1);
+            std::copy_n(first, n, dims + ndim - n);
+        }
 
         constexpr bool operator==(const shape_t& shape) const = default;
 
-        constexpr size_t size() const noexcept { return rows * cols; }
+        constexpr size_t& operator[](const size_t axis) noexcept { return dims[axis]; }
+        constexpr size_t operator[](const size_t axis) const noexcept { return dims[axis]; }
+
+        constexpr size_t rows() const noexcept { return dims[ndim - 2]; }
+        constexpr size_t cols() const noexcept { return dims[ndim - 1]; }
+
+        constexpr size_t size() const noexcept {
+            size_t res = 1;
+
+            for (size_t i = 0; i < ndim; i++) {
+                res *= dims[i];
+            }
+            return res;
+        }
 
         friend std::ostream& operator<<(std::ostream& out, const shape_t& shape) {
-            return out << "shape_t(" << shape.rows << ", " << shape.cols << ')';
+            out << "shape_t(";
+
+            for (size_t i = 0; i < shape.ndim; i++) {
+                out << (i ? ", " : "") << shape.dims[i];
+            }
+            return out << ')';
         }
     };
 
+    using strides_t = std::array<ll_t, shape_t::max_ndim>;
+
+    enum class order_t : uint8_t { C, F };
+
+    // Per-call choice between the std:: functions and the vectorizable math::fast kernels for transcendental ufuncs.
+    enum class precision_t : uint8_t { accurate, fast };
+
+    // Accumulation of floating-point sums: pairwise over vector lanes, or pairwise with a compensation term for long ill-conditioned sums.
+    enum class summation_t : uint8_t { pairwise, compensated };
+
+    // Identity of a binary ufunc, the result of reducing nothing. maximum and minimum have none, but reduce the lowest and the highest
+    // value (infinities for floating point) away, which stand in for unselected elements.
+    enum class identity_t : uint8_t { none, zero, one, all_ones, lowest, highest };
+
+    constexpr strides_t contiguous_strides(const shape_t& shape, const order_t order = order_t::C) noexcept {
+        strides_t res = {};
+        ll_t stride = 1;
+
+        for (size_t k = 0; k < shape.ndim; k++) {
+            const size_t i = order == order_t::C ? shape.ndim - 1 - k : k;
+            res[i] = stride;
+            stride *= shape[i];
+        }
+        return res;
+    }
+
+    constexpr bool is_contiguous(const shape_t& shape, const strides_t& strides, const order_t order = order_t::C) noexcept {
+        ll_t stride = 1;
+
+        for (size_t k = 0; k < shape.ndim; k++) {
+            const size_t i = order == order_t::C ? shape.ndim - 1 - k : k;
+
+            if (shape[i] != 1 && strides[i] != stride) {
+                return false;
+            }
+            stride *= shape[i];
+        }
+        return true;
+    }
+
     template <typename T>
     struct out_t {
         array<T>* ptr = nullptr;
@@ -262,6 +411,7 @@ namespace numcpp {
 
     template <typename T>
     struct range_t {
+        using value_type = T;
         T start, stop, step;
 
         constexpr range_t(const T stop) noexcept : range_t(T(0), stop) {}
@@ -273,16 +423,20 @@ namespace numcpp {
             }
         }
 
+        constexpr T operator[](const size_t i) const noexcept { return static_cast<T>(start + static_cast<T>(i) * step); }
+
         buffer_t<T> evaluate() const noexcept {
-            buffer_t<T> buf(size());
-            size_t i = 0;
+            const size_t n = size();
+            buffer_t<T> buf(n);
 
-            for (T value = start; value < stop; value += step) {
-                buf[i++] = value;
+            for (size_t i = 0; i < n; i++) {
+                buf[i] = (*this)[i];
             }
             return buf;
         }
 
+        operator array<T>() const { return array<T>(evaluate(), size()); }
+
         constexpr size_t size() const noexcept {
             if ((step > 0 && start >= stop) || (step < 0 && start <= stop)) {
                 return 0;
@@ -293,18 +447,58 @@ namespace numcpp {
                 return static_cast<size_t>(std::ceil((stop - start) / step));
             }
         }
+
+        constexpr shape_t shape() const noexcept { return size(); }
     };
 
+    template <typename T>
+    struct space_t {
+        using value_type = T;
+        T start, stop, step, base;
+        size_t num;
+        bool endpoint;
+
+        constexpr space_t(const T start, const T stop, const size_t num, const bool endpoint = true, const T base = T(0)) noexcept :
+            start(start), stop(stop), step(num > size_t(endpoint) ? (stop - start) / static_cast<T>(num - endpoint) : T(0)), base(base), num(num),
+            endpoint(endpoint) {}
+
+        constexpr T operator[](const size_t i) const noexcept {
+            const T value = endpoint && i + 1 == num ? stop : start + static_cast<T>(i) * step;
+            return base == T(0) ? value : std::pow(base, value);
+        }
+
+        buffer_t<T> evaluate() const noexcept {
+            buffer_t<T> buf(num);
+
+            for (size_t i = 0; i < num; i++) {
+                buf[i] = (*this)[i];
+            }
+            return buf;
+        }
+
+        operator array<T>() const { return array<T>(evaluate(), num); }
+
+        constexpr size_t size() const noexcept { return num; }
+        constexpr shape_t shape() const noexcept { return num; }
+    };
+
+    // Mask argument of ufuncs and reductions: a bool array or a bitmask_t. Kernels read either through visit, which hands them a
+    // `const bool*` or a detail::bit_reader_t indexed alike, with the mask's element strides.
     struct where_t {
         const array<bool>* ptr = nullptr;
+        const bitmask_t* bits = nullptr;
 
         constexpr where_t() noexcept = default;
         constexpr where_t(const array<bool>& arr) noexcept : ptr(&arr) {}
+        constexpr where_t(const bitmask_t& mask) noexcept : bits(&mask) {}
         constexpr where_t(std::nullptr_t) noexcept {}
 
-        constexpr operator bool() const noexcept { return ptr != nullptr; }
-        constexpr const array<bool>& operator*() const noexcept { return *ptr; }
-        constexpr const array<bool>* operator->() const noexcept { return ptr; }
+        constexpr operator bool() const noexcept { return ptr != nullptr || bits != nullptr; }
+
+        shape_t shape() const noexcept;
+        strides_t strides() const noexcept;
+        template <typename Visitor>
+        decltype(auto) visit(Visitor visitor) const;
     };
 
     namespace none {
@@ -325,43 +519,79 @@ namespace numcpp {
 
     class index_t {
         using array_ptr = std::unique_ptr<array<ll_t>>;
-        const std::variant<ll_t, slice_t, array_ptr> row, col;
+        using item_t = std::variant<ll_t, slice_t, array_ptr>;
+        item_t items[shape_t::max_ndim];
+        uint8_t count;
 
     public:
-        constexpr index_t(const ll_t i, const ll_t j) noexcept : row(i), col(j) {}
-        constexpr index_t(const ll_t i, const slice_t& j = none::slice) noexcept : row(i), col(j) {}
-        index_t(const ll_t i, const array<ll_t>& j) noexcept : row(i), col(std::make_unique<array<ll_t>>(j)) {}
+        constexpr index_t(const ll_t i) noexcept : items{i}, count(1) {}
+        constexpr index_t(const slice_t& i) noexcept : items{i}, count(1) {}
+        index_t(const array<ll_t>& i) noexcept : items{std::make_unique<array<ll_t>>(i)}, count(1) {}
+
+        constexpr index_t(const ll_t i, const ll_t j) noexcept : items{i, j}, count(2) {}
+        constexpr index_t(const ll_t i, const slice_t& j) noexcept : items{i, j}, count(2) {}
+        index_t(const ll_t i, const array<ll_t>& j) noexcept : items{i, std::make_unique<array<ll_t>>(j)}, count(2) {}
+
+        constexpr index_t(const slice_t& i, const ll_t j) noexcept : items{i, j}, count(2) {}
+        constexpr index_t(const slice_t& i, const slice_t& j) noexcept : items{i, j}, count(2) {}
+        index_t(const slice_t& i, const array<ll_t>& j) noexcept : items{i, std::make_unique<array<ll_t>>(j)}, count(2) {}
+
+        index_t(const array<ll_t>& i, const ll_t j) noexcept : items{std::make_unique<array<ll_t>>(i), j}, count(2) {}
+        index_t(const array<ll_t>& i, const slice_t& j) noexcept : items{std::make_unique<array<ll_t>>(i), j}, count(2) {}
+        index_t(const array<ll_t>& i, const array<ll_t>& j) noexcept :
+            items{std::make_unique<array<ll_t>>(i), std::make_unique<array<ll_t>>(j)}, count(2) {}
+
+        template <typename... Items>
+        requires(sizeof...(Items) > 2 && ((std::is_integral_v<Items> || std::is_same_v<Items, slice_t>) && ...))
+        constexpr index_t(const Items&... list) :
+            items{item_t(std::in_place_type<std::conditional_t<std::is_integral_v<Items>, ll_t, slice_t>>, list)...}, count(sizeof...(Items)) {
+            static_assert(sizeof...(Items) <= shape_t::max_ndim, "too many indices for array");
+        }
+        index_t(const ll_t (&indices)[shape_t::max_ndim], const size_t n) noexcept : count(n) { std::copy_n(indices, n, items); }
 
-        constexpr index_t(const slice_t& i, const ll_t j) noexcept : row(i), col(j) {}
-        constexpr index_t(const slice_t& i, const slice_t& j = none::slice) noexcept : row(i), col(j) {}
-        index_t(const slice_t& i, const array<ll_t>& j) noexcept : row(i), col(std::make_unique<array<ll_t>>(j)) {}
+        constexpr size_t size() const noexcept { return count; }
 
-        index_t(const array<ll_t>& i, const ll_t j) noexcept : row(std::make_unique<array<ll_t>>(i)), col(j) {}
-        index_t(const array<ll_t>& i, const slice_t& j = none::slice) noexcept : row(std::make_unique<array<ll_t>>(i)), col(j) {}
-        index_t(const array<ll_t>& i, const array<ll_t>& j) noexcept : row(std::make_unique<array<ll_t>>(i)), col(std::make_unique<array<ll_t>>(j)) {}
+        void set(const size_t axis, const slice_t& slice) noexcept { items[axis] = slice; }
+
+        constexpr bool is_scalar(const size_t axis) const noexcept { return axis < count && std::holds_alternative<ll_t>(items[axis]); }
+        constexpr bool is_slice(const size_t axis) const noexcept { return axis >= count || std::holds_alternative<slice_t>(items[axis]); }
+        constexpr bool is_array(const size_t axis) const noexcept { return axis < count && std::holds_alternative<array_ptr>(items[axis]); }
+
+        constexpr ll_t get_scalar(const size_t axis) const noexcept { return std::get<ll_t>(items[axis]); }
+        constexpr slice_t get_slice(const size_t axis) const noexcept { return axis < count ? std::get<slice_t>(items[axis]) : none::slice; }
+        array<ll_t>* get_array(const size_t axis) const noexcept { return std::get<array_ptr>(items[axis]).get(); }
+
+        constexpr bool has_array() const noexcept {
+            for (size_t i = 0; i < count; i++) {
+                if (is_array(i)) {
+                    return true;
+                }
+            }
+            return false;
+        }
 
-        constexpr bool is_scalar_row() const noexcept { return std::holds_alternative<ll_t>(row); }
-        constexpr bool is_scalar_col() const noexcept { return std::holds_alternative<ll_t>(col); }
+        constexpr bool is_scalar_row() const noexcept { return is_scalar(0); }
+        constexpr bool is_scalar_col() const noexcept { return is_scalar(1); }
         constexpr bool is_scalar() const noexcept { return is_scalar_row() && is_scalar_col(); }
 
-        constexpr bool is_slice_row() const noexcept { return std::holds_alternative<slice_t>(row); }
-        constexpr bool is_slice_col() const noexcept { return std::holds_alternative<slice_t>(col); }
+        constexpr bool is_slice_row() const noexcept { return is_slice(0); }
+        constexpr bool is_slice_col() const noexcept { return is_slice(1); }
         constexpr bool is_slice() const noexcept { return is_slice_row() && is_slice_col(); }
 
-        constexpr bool is_array_row() const noexcept { return std::holds_alternative<array_ptr>(row); }
-        constexpr bool is_array_col() const noexcept { return std::holds_alternative<array_ptr>(col); }
+        constexpr bool is_array_row() const noexcept { return is_array(0); }
+        constexpr bool is_array_col() const noexcept { return is_array(1); }
         constexpr bool is_array() const noexcept { return is_array_row() && is_array_col(); }
 
-        constexpr ll_t get_scalar_row() const noexcept { return std::get<ll_t>(row); }
-        constexpr ll_t get_scalar_col() const noexcept { return std::get<ll_t>(col); }
+        constexpr ll_t get_scalar_row() const noexcept { return get_scalar(0); }
+        constexpr ll_t get_scalar_col() const noexcept { return get_scalar(1); }
         constexpr std::pair<ll_t, ll_t> get_scalars() const noexcept { return {get_scalar_row(), get_scalar_col()}; }
 
-        constexpr slice_t get_slice_row() const noexcept { return std::get<slice_t>(row); }
-        constexpr slice_t get_slice_col() const noexcept { return std::get<slice_t>(col); }
+        constexpr slice_t get_slice_row() const noexcept { return get_slice(0); }
+        constexpr slice_t get_slice_col() const noexcept { return get_slice(1); }
         constexpr std::pair<slice_t, slice_t> get_slices() const noexcept { return {get_slice_row(), get_slice_col()}; }
 
-        array<ll_t>* get_array_row() const noexcept { return std::get<array_ptr>(row).get(); }
-        array<ll_t>* get_array_col() const noexcept { return std::get<array_ptr>(col).get(); }
+        array<ll_t>* get_array_row() const noexcept { return get_array(0); }
+        array<ll_t>* get_array_col() const noexcept { return get_array(1); }
         std::pair<array<ll_t>*, array<ll_t>*> get_arrays() const noexcept { return {get_array_row(), get_array_col()}; }
     };
 } // namespace numcpp
@@ -3,7 +3,7 @@
 namespace numcpp {
     template <typename T, typename dtype, typename Func, typename... Args>
     array<dtype> ufunc_unary(const array<T>& arr, out_t<dtype> out, const where_t& where, Func func, Args&&... args) {
-        const shape_t arr_shape = arr.shape(), where_shape = where ? where->shape() : none::shape;
+        const shape_t arr_shape = arr.shape(), where_shape = where ? where.shape() : none::shape;
 
         if (out && out->shape() != arr_shape) {
             throw std::invalid_argument("Shape mis-match with out and expected out-put");
@@ -11,24 +11,93 @@ namespace numcpp {
         if (where && arr_shape != broadcast_shape(arr_shape, where_shape)) {
             throw std::invalid_argument("Cannot broadcast where shape to array shape");
         }
-        buffer_t<dtype> result = out ? buffer(*out.ptr) : buffer_t<dtype>(arr_shape.size());
-        size_t idx = 0;
+        NUMCPP_PROFILE_SCOPE(ufunc_unary, arr_shape.size(), arr_shape.size() * sizeof(T), arr_shape.size() * sizeof(dtype));
+        detail::fp_scope_t fp_errors(!std::is_same_v<dtype, bool>);
+        array<dtype> result = out ? array<dtype>() : array<dtype>(buffer_t<dtype>(arr_shape.size()), arr_shape, detail::result_order(arr));
+        array<dtype>& target = out ? *out : result;
+        dtype* res = target.data();
+        const T* src = arr.data();
 
-        for (ll_t i = 0; i < arr_shape.rows; i++) {
-            for (ll_t j = 0; j < arr_shape.cols; j++) {
-                result[idx++] = !where || (*where)[broadcast_index({i, j}, where_shape)]
-                    ? func(static_cast<T>(arr[{i, j}]), std::forward<Args>(args)...)
-                    : dtype(0);
-            }
+        if (!where) {
+            detail::strided_loop<2>(arr_shape, {strides(target), strides(arr)}, [&](const auto& pos, const size_t n, const auto& step) {
+                for (size_t k = 0; k < n; k++) {
+                    res[pos[0] + ll_t(k) * step[0]] = func(static_cast<T>(src[pos[1] + ll_t(k) * step[1]]), std::forward<Args>(args)...);
+                }
+            });
+        } else {
+            const strides_t mask_strides = detail::broadcast_strides(where_shape, where.strides(), arr_shape);
+            where.visit([&](const auto mask) {
+                detail::strided_loop<3>(arr_shape, {strides(target), strides(arr), mask_strides},
+                                        [&](const auto& pos, const size_t n, const auto& step) {
+                                            for (size_t k = 0; k < n; k++) {
+                                                res[pos[0] + ll_t(k) * step[0]] = mask[pos[2] + ll_t(k) * step[2]]
+                                                    ? func(static_cast<T>(src[pos[1] + ll_t(k) * step[1]]), std::forward<Args>(args)...)
+                                                    : dtype(0);
+                                            }
+                                        });
+            });
+        }
+        fp_errors.report();
+        if (out) {
+            return *out;
         }
-        return out ? *out.ptr : array<dtype>(std::move(result), arr_shape);
+        return result;
     }
 
-    template <typename L, typename R, typename dtype, typename Func, typename... Args>
-    array<dtype> ufunc_binary(const array<L>& lhs, const array<R>& rhs, out_t<dtype> out, const where_t& where, Func func, Args&&... args) {
-        const shape_t lhs_shape = lhs.shape(), rhs_shape = rhs.shape(), where_shape = where ? where->shape() : none::shape;
+    template <typename G, typename dtype, typename Func, typename... Args>
+    requires(is_lazy_v<G>)
+    array<dtype> ufunc_unary(const G& gen, out_t<dtype> out, const where_t& where, Func func, Args&&... args) {
+        using T = typename G::value_type;
+        const size_t size = gen.size();
+        const shape_t gen_shape = gen.shape(), where_shape = where ? where.shape() : none::shape;
+
+        if (out && out->shape() != gen_shape) {
+            throw std::invalid_argument("Shape mis-match with out and expected out-put");
+        }
+        if (where && gen_shape != broadcast_shape(gen_shape, where_shape)) {
+            throw std::invalid_argument("Cannot broadcast where shape to array shape");
+        }
+        NUMCPP_PROFILE_SCOPE(ufunc_unary, size, 0, size * sizeof(dtype));
+        detail::fp_scope_t fp_errors(!std::is_same_v<dtype, bool>);
+        array<dtype> result = out ? array<dtype>() : array<dtype>(buffer_t<dtype>(size), gen_shape);
+        array<dtype>& target = out ? *out : result;
+        dtype* res = target.data();
+        const strides_t gen_strides = contiguous_strides(gen_shape);
+
+        if (!where) {
+            detail::strided_loop<2>(gen_shape, {strides(target), gen_strides}, [&](const auto& pos, const size_t n, const auto& step) {
+                for (size_t k = 0; k < n; k++) {
+                    res[pos[0] + ll_t(k) * step[0]] = func(static_cast<T>(gen[pos[1] + ll_t(k) * step[1]]), std::forward<Args>(args)...);
+                }
+            });
+        } else {
+            const strides_t mask_strides = detail::broadcast_strides(where_shape, where.strides(), gen_shape);
+            where.visit([&](const auto mask) {
+                detail::strided_loop<3>(gen_shape, {strides(target), gen_strides, mask_strides},
+                                        [&](const auto& pos, const size_t n, const auto& step) {
+                                            for (size_t k = 0; k < n; k++) {
+                                                res[pos[0] + ll_t(k) * step[0]] = mask[pos[2] + ll_t(k) * step[2]]
+                                                    ? func(static_cast<T>(gen[pos[1] + ll_t(k) * step[1]]), std::forward<Args>(args)...)
+                                                    : dtype(0);
+                                            }
+                                        });
+            });
+        }
+        fp_errors.report();
+        if (out) {
+            return *out;
+        }
+        return result;
+    }
+
+    // Either operand may be a generator, whose elements are computed as they are read.
+    template <typename A, typename B, typename dtype, typename Func, typename... Args>
+    requires(detail::is_operand_v<A> && detail::is_operand_v<B>)
+    array<dtype> ufunc_binary(const A& lhs, const B& rhs, out_t<dtype> out, const where_t& where, Func func, Args&&... args) {
+        using L = detail::element_t<A>;
+        using R = detail::element_t<B>;
+        const shape_t lhs_shape = lhs.shape(), rhs_shape = rhs.shape(), where_shape = where ? where.shape() : none::shape;
         shape_t res_shape = broadcast_shape(lhs_shape, rhs_shape);
-        size_t idx = 0;
 
         if (out && out->shape() != res_shape) {
             throw std::invalid_argument("Shape mis-match with out and expected out-put");
@@ -41,57 +110,1294 @@ namespace numcpp {
         if (res_shape.size() == 0) {
             return array<dtype>();
         }
-        buffer_t<dtype> result = out ? buffer(*out.ptr) : buffer_t<dtype>(res_shape.size());
+        NUMCPP_PROFILE_SCOPE(ufunc_binary, res_shape.size(), detail::stored_bytes(lhs) + detail::stored_bytes(rhs), res_shape.size() * sizeof(dtype));
+        detail::fp_scope_t fp_errors(!std::is_same_v<dtype, bool>);
+        array<dtype> result = out ? array<dtype>() : array<dtype>(buffer_t<dtype>(res_shape.size()), res_shape, detail::result_order(lhs, rhs));
+        array<dtype>& target = out ? *out : result;
+        dtype* res = target.data();
+        const auto& lhs_ptr = detail::elements(lhs);
+        const auto& rhs_ptr = detail::elements(rhs);
+        const strides_t lhs_strides = detail::broadcast_strides(lhs_shape, detail::element_strides(lhs), res_shape);
+        const strides_t rhs_strides = detail::broadcast_strides(rhs_shape, detail::element_strides(rhs), res_shape);
+
+        if (!where) {
+            detail::strided_loop<3>(res_shape, {strides(target), lhs_strides, rhs_strides}, [&](const auto& pos, const size_t n, const auto& step) {
+                for (size_t k = 0; k < n; k++) {
+                    res[pos[0] + ll_t(k) * step[0]] = func(static_cast<L>(lhs_ptr[pos[1] + ll_t(k) * step[1]]),
+                                                           static_cast<R>(rhs_ptr[pos[2] + ll_t(k) * step[2]]), std::forward<Args>(args)...);
+                }
+            });
+        } else {
+            const strides_t mask_strides = detail::broadcast_strides(where_shape, where.strides(), res_shape);
+            where.visit([&](const auto mask) {
+                detail::strided_loop<4>(res_shape, {strides(target), lhs_strides, rhs_strides, mask_strides},
+                                        [&](const auto& pos, const size_t n, const auto& step) {
+                                            for (size_t k = 0; k < n; k++) {
+                                                res[pos[0] + ll_t(k) * step[0]] = mask[pos[3] + ll_t(k) * step[3]]
+                                                    ? func(static_cast<L>(lhs_ptr[pos[1] + ll_t(k) * step[1]]),
+                                                           static_cast<R>(rhs_ptr[pos[2] + ll_t(k) * step[2]]), std::forward<Args>(args)...)
+                                                    : dtype(0);
+                                            }
+                                        });
+            });
+        }
+        fp_errors.report();
+        if (out) {
+            return *out;
+        }
+        return result;
+    }
+
+    template <typename X, typename Y, typename Z, typename dtype, typename Func, typename... Args>
+    array<dtype> ufunc_ternary(const array<X>& x, const array<Y>& y, const array<Z>& z, out_t<dtype> out, const where_t& where, Func func,
+                               Args&&... args) {
+        const shape_t x_shape = x.shape(), y_shape = y.shape(), z_shape = z.shape(), where_shape = where ? where.shape() : none::shape;
+        shape_t res_shape = broadcast_shape(broadcast_shape(x_shape, y_shape), z_shape);
 
-        for (ll_t i = 0; i < res_shape.rows; i++) {
-            for (ll_t j = 0; j < res_shape.cols; j++) {
-                result[idx++] = !where || (*where)[broadcast_index({i, j}, where_shape)]
-                    ? func(static_cast<L>(lhs[broadcast_index({i, j}, lhs_shape)]), static_cast<R>(rhs[broadcast_index({i, j}, rhs_shape)]),
-                           std::forward<Args>(args)...)
-                    : dtype(0);
+        if (out && out->shape() != res_shape) {
+            throw std::invalid_argument("Shape mis-match with out and expected out-put");
+        }
+        if (where && res_shape != broadcast_shape(res_shape, where_shape)) {
+            throw std::invalid_argument("Cannot broadcast where shape to array shape");
+        }
+
+        if (res_shape.size() == 0) {
+            return array<dtype>();
+        }
+        NUMCPP_PROFILE_SCOPE(ufunc_ternary, res_shape.size(), x.size() * sizeof(X) + y.size() * sizeof(Y) + z.size() * sizeof(Z),
+                             res_shape.size() * sizeof(dtype));
+        detail::fp_scope_t fp_errors(!std::is_same_v<dtype, bool>);
+        array<dtype> result = out ? array<dtype>() : array<dtype>(buffer_t<dtype>(res_shape.size()), res_shape, detail::result_order(x, y, z));
+        array<dtype>& target = out ? *out : result;
+        dtype* res = target.data();
+        const X* x_ptr = x.data();
+        const Y* y_ptr = y.data();
+        const Z* z_ptr = z.data();
+        const strides_t x_strides = detail::broadcast_strides(x_shape, strides(x), res_shape);
+        const strides_t y_strides = detail::broadcast_strides(y_shape, strides(y), res_shape);
+        const strides_t z_strides = detail::broadcast_strides(z_shape, strides(z), res_shape);
+
+        if (!where) {
+            detail::strided_loop<4>(res_shape, {strides(target), x_strides, y_strides, z_strides},
+                                    [&](const auto& pos, const size_t n, const auto& step) {
+                                        for (size_t k = 0; k < n; k++) {
+                                            res[pos[0] + ll_t(k) * step[0]] = func(static_cast<X>(x_ptr[pos[1] + ll_t(k) * step[1]]),
+                                                                                   static_cast<Y>(y_ptr[pos[2] + ll_t(k) * step[2]]),
+                                                                                   static_cast<Z>(z_ptr[pos[3] + ll_t(k) * step[3]]),
+                                                                                   std::forward<Args>(args)...);
+                                        }
+                                    });
+        } else {
+            const strides_t mask_strides = detail::broadcast_strides(where_shape, where.strides(), res_shape);
+            where.visit([&](const auto mask) {
+                detail::strided_loop<5>(res_shape, {strides(target), x_strides, y_strides, z_strides, mask_strides},
+                                        [&](const auto& pos, const size_t n, const auto& step) {
+                                            for (size_t k = 0; k < n; k++) {
+                                                res[pos[0] + ll_t(k) * step[0]] = mask[pos[4] + ll_t(k) * step[4]]
+                                                    ? func(static_cast<X>(x_ptr[pos[1] + ll_t(k) * step[1]]),
+                                                           static_cast<Y>(y_ptr[pos[2] + ll_t(k) * step[2]]),
+                                                           static_cast<Z>(z_ptr[pos[3] + ll_t(k) * step[3]]), std::forward<Args>(args)...)
+                                                    : dtype(0);
+                                            }
+                                        });
+            });
+        }
+        fp_errors.report();
+        if (out) {
+            return *out;
+        }
+        return result;
+    }
+
+    namespace detail {
+        // Element count from which ufunc_nary runs in parallel when asked to.
+        inline constexpr size_t parallel_nary_size = size_t(1) << 16;
+    } // namespace detail
+
+    // Applies func elementwise to any number of broadcast operands in a single strided pass. With `parallel`, results of at least
+    // parallel_nary_size elements are split across threads along their slowest axis, so func must then be safe to call concurrently.
+    template <typename dtype, typename Func, typename... Ts>
+    array<dtype> ufunc_nary(out_t<dtype> out, const bool parallel, Func func, const detail::operand_t<Ts>&... operands) {
+        constexpr size_t N = sizeof...(Ts);
+        shape_t res_shape(1, 1);
+        ((res_shape = broadcast_shape(res_shape, operands.shape)), ...);
+
+        if (out && out->shape() != res_shape) {
+            throw std::invalid_argument("Shape mis-match with out and expected out-put");
+        }
+        if (res_shape.size() == 0) {
+            return out ? *out : array<dtype>();
+        }
+        NUMCPP_PROFILE_SCOPE(ufunc_nary, res_shape.size(), ((operands.shape.size() * sizeof(Ts)) + ...), res_shape.size() * sizeof(dtype));
+        detail::fp_scope_t fp_errors(!std::is_same_v<dtype, bool>);
+        const int votes = ((is_contiguous(operands.shape, operands.strides, order_t::F) - is_contiguous(operands.shape, operands.strides)) + ...);
+        const order_t order = votes > 0 ? order_t::F : order_t::C;
+        array<dtype> result = out ? array<dtype>() : array<dtype>(buffer_t<dtype>(res_shape.size()), res_shape, order);
+        array<dtype>& target = out ? *out : result;
+        dtype* res = target.data();
+        const std::array<strides_t, N + 1> loop_strides = {strides(target),
+                                                           detail::broadcast_strides(operands.shape, operands.strides, res_shape)...};
+        auto run = [&]<size_t... I>(std::index_sequence<I...>, const shape_t& shape, const std::array<ll_t, N + 1>& offset) {
+            dtype* dst = res + offset[0];
+            const std::tuple<const Ts*...> src = {(operands.data + offset[I + 1])...};
+
+            detail::strided_loop<N + 1>(shape, loop_strides, [&](const auto& pos, const size_t n, const auto& step) {
+                for (size_t k = 0; k < n; k++) {
+                    dst[pos[0] + ll_t(k) * step[0]] = static_cast<dtype>(func(std::get<I>(src)[pos[I + 1] + ll_t(k) * step[I + 1]]...));
+                }
+            });
+        };
+        size_t axis = res_shape.ndim;
+
+        for (size_t d = 0; d < res_shape.ndim; d++) {
+            if (res_shape[d] > 1 && (axis == res_shape.ndim || std::abs(loop_strides[0][d]) > std::abs(loop_strides[0][axis]))) {
+                axis = d;
             }
         }
-        return out ? *out.ptr : array<dtype>(std::move(result), res_shape);
+        if (!parallel || res_shape.size() < detail::parallel_nary_size || axis == res_shape.ndim) {
+            run(std::index_sequence_for<Ts...>(), res_shape, {});
+        } else {
+            const size_t grain = detail::parallel_nary_size / 4 / (res_shape.size() / res_shape[axis]) + 1;
+            detail::parallel_for(res_shape[axis], grain, [&](const size_t begin, const size_t end) {
+                shape_t part = res_shape;
+                std::array<ll_t, N + 1> offset;
+                part[axis] = end - begin;
+
+                for (size_t k = 0; k <= N; k++) {
+                    offset[k] = ll_t(begin) * loop_strides[k][axis];
+                }
+                run(std::index_sequence_for<Ts...>(), part, offset);
+            });
+        }
+        fp_errors.report();
+        if (out) {
+            return *out;
+        }
+        return result;
     }
 
-    template <typename T, typename dtype, typename Func, typename... Args>
-    array<dtype> ufunc_axes_unary(const array<T>& arr, const int8_t axis, out_t<dtype> out, const bool keepdims, Func func, Args&&... args) {
-        auto [row, col] = arr.shape();
-        buffer_t<dtype> buf;
-        array<dtype> res;
+    namespace detail {
+        // Elements tested between checks for a mismatch by all_pairs.
+        inline constexpr size_t all_pairs_block = 256;
+    } // namespace detail
 
-        if (axis == none::axis) {
-            if (out && out->shape() != shape_t(1)) {
-                throw std::invalid_argument("Shape mis-match with out and expected out-put");
+    // True when pred holds for every pair of the broadcast operands, without allocating. Each block of all_pairs_block pairs is folded
+    // with a branch-free and, which vectorizes, and the scan stops after the first block holding a mismatch.
+    template <typename L, typename R, typename Pred>
+    bool ufunc_all_pairs(const detail::operand_t<L>& lhs, const detail::operand_t<R>& rhs, Pred pred) {
+        const shape_t shape = broadcast_shape(lhs.shape, rhs.shape);
+        const strides_t lhs_strides = detail::broadcast_strides(lhs.shape, lhs.strides, shape);
+        const strides_t rhs_strides = detail::broadcast_strides(rhs.shape, rhs.strides, shape);
+        NUMCPP_PROFILE_SCOPE(ufunc_all_pairs, shape.size(), lhs.shape.size() * sizeof(L) + rhs.shape.size() * sizeof(R), 0);
+        bool res = true;
+
+        detail::strided_loop<2>(shape, {lhs_strides, rhs_strides}, [&](const auto& pos, const size_t n, const auto& step) {
+            const L* l = lhs.data + pos[0];
+            const R* r = rhs.data + pos[1];
+
+            for (size_t k = 0; k < n && res; k += detail::all_pairs_block) {
+                const size_t end = std::min(n, k + detail::all_pairs_block);
+                bool block = true;
+
+                for (size_t j = k; j < end; j++) {
+                    block &= pred(l[ll_t(j) * step[0]], r[ll_t(j) * step[1]]);
+                }
+                res = block;
             }
-            buf = out ? buffer(*out.ptr) : buffer_t<dtype>(1);
-            buf[0] = func(arr, std::forward<Args>(args)...);
-            res = array<dtype>(std::move(buf), 1);
-        } else if (axis == 0 || axis == -2) {
-            if (out && out->shape() != shape_t(col)) {
-                throw std::invalid_argument("Shape mis-match with out and expected out-put");
+        });
+        return res;
+    }
+
+    namespace detail {
+        // Updates from which ufunc_scatter, and index count from which ufunc_gather, run in parallel.
+        inline constexpr size_t parallel_scatter_size = size_t(1) << 15;
+        // Slab extent from which ufunc_scatter splits the slab, rather than the indices, across threads.
+        inline constexpr size_t parallel_slab_size = 256;
+
+        // Element types ufunc_scatter may update concurrently through a lock-free compare-and-swap.
+        template <typename T>
+        inline constexpr bool has_atomic_update_v = false;
+        template <typename T>
+        requires(std::is_arithmetic_v<T>)
+        inline constexpr bool has_atomic_update_v<T> = std::atomic_ref<T>::is_always_lock_free;
+
+        // Memory offset of the element at flat C-order position i.
+        inline ll_t flat_offset(size_t i, const shape_t& shape, const strides_t& strides) noexcept {
+            ll_t offset = 0;
+
+            for (size_t d = shape.ndim; d-- > 0;) {
+                offset += ll_t(i % shape[d]) * strides[d];
+                i /= shape[d];
+            }
+            return offset;
+        }
+
+        // Where index i of a gather or scatter lands: at base[i] in the source array, the single element at that flat position for
+        // none::axis and otherwise the slab at that position along the axis. Slab element j sits at slab[j] from its base, and at
+        // i * inner + slab_out[j] in the C-ordered result a[indices] of shape `shape`.
+        struct gather_plan_t {
+            buffer_t<ll_t> base = buffer_t<ll_t>();
+            std::vector<ll_t> slab = {0}, slab_out = {0};
+            shape_t shape = shape_t();
+            size_t inner = 1;
+            bool sorted = true, contiguous = true;
+        };
+
+        template <typename T>
+        gather_plan_t gather_plan(const array<T>& a, const array<ll_t>& indices, const int8_t axis) {
+            const shape_t a_shape = a.shape();
+            const strides_t a_strides = strides(a);
+            const array<ll_t> flat = is_contiguous(indices.shape(), strides(indices)) ? indices : indices.copy();
+            const ll_t* idx = flat.data();
+            const size_t count = flat.size(), ax = axis == none::axis ? 0 : normalize_axis(axis, a_shape.ndim);
+            const size_t dim = axis == none::axis ? a_shape.size() : a_shape[ax];
+            const bool flat_contiguous = is_contiguous(a_shape, a_strides);
+            gather_plan_t plan;
+            plan.base = buffer_t<ll_t>(count);
+            ll_t* base = plan.base.data();
+            ll_t prev = 0;
+
+            for (size_t i = 0; i < count; i++) {
+                const ll_t j = idx[i] < 0 ? idx[i] + ll_t(dim) : idx[i];
+
+                if (j < 0 || j >= ll_t(dim)) {
+                    throw std::out_of_range("index " + std::to_string(idx[i]) + " is out of bounds for size " + std::to_string(dim));
+                }
+                plan.sorted &= j >= prev;
+                prev = j;
+
+                if (axis != none::axis) {
+                    base[i] = j * a_strides[ax];
+                } else {
+                    base[i] = flat_contiguous ? j : flat_offset(size_t(j), a_shape, a_strides);
+                }
             }
-            buf = out ? buffer(*out.ptr) : buffer_t<dtype>(col);
+            if (axis == none::axis) {
+                plan.shape = flat.shape();
+                return plan;
+            }
+            shape_t slab_shape = a_shape;
+            slab_shape[ax] = 1;
+            plan.shape = a_shape;
+            plan.shape[ax] = count;
 
-            for (ll_t i = 0; i < col; i++) {
-                buf[i] = func(arr[{slice_t(), i}], std::forward<Args>(args)...);
+            for (size_t d = ax + 1; d < a_shape.ndim; d++) {
+                plan.inner *= a_shape[d];
             }
-            res = array<dtype>(std::move(buf), col);
-        } else if (axis == 1 || axis == -1) {
-            if (out && out->shape() != shape_t(row, 1)) {
-                throw std::invalid_argument("Shape mis-match with out and expected out-put");
+            plan.slab.resize(slab_shape.size());
+            plan.slab_out.resize(slab_shape.size());
+
+            for (size_t j = 0; j < slab_shape.size(); j++) {
+                plan.slab[j] = flat_offset(j, slab_shape, a_strides);
+                plan.slab_out[j] = ll_t(j / plan.inner * count * plan.inner + j % plan.inner);
+                plan.contiguous &= plan.slab[j] == ll_t(j) && plan.slab_out[j] == ll_t(j);
             }
-            buf = out ? buffer(*out.ptr) : buffer_t<dtype>(row);
+            return plan;
+        }
+    } // namespace detail
+
+    // a[indices] for the flattened a with none::axis and along axis otherwise, where the slab at each index is copied whole. Indices
+    // are spread over threads from parallel_scatter_size of them.
+    template <typename T>
+    array<T> ufunc_gather(const array<T>& a, const array<ll_t>& indices, const int8_t axis, out_t<T> out) {
+        const detail::gather_plan_t plan = detail::gather_plan(a, indices, axis);
+        const size_t count = plan.base.size, slab = plan.slab.size();
+
+        if (out && out->shape() != plan.shape) {
+            throw std::invalid_argument("Shape mis-match with out and expected out-put");
+        }
+        NUMCPP_PROFILE_SCOPE(ufunc_gather, plan.shape.size(), plan.shape.size() * sizeof(T) + count * sizeof(ll_t), plan.shape.size() * sizeof(T));
+        const bool direct = out && is_contiguous(plan.shape, strides(*out));
+        array<T> result = direct ? array<T>() : array<T>(buffer_t<T>(plan.shape.size()), plan.shape);
+        array<T>& target = direct ? *out : result;
+        T* res = target.data();
+        const T* src = a.data();
+        const ll_t* base = plan.base.data();
 
-            for (size_t i = 0; i < row; i++) {
-                buf[i] = func(arr[i], std::forward<Args>(args)...);
+        detail::parallel_for(count, detail::parallel_scatter_size / slab + 1, [&](const size_t begin, const size_t end) {
+            if (slab == 1) {
+                for (size_t i = begin; i < end; i++) {
+                    res[i] = src[base[i]];
+                }
+            } else if (plan.contiguous) {
+                for (size_t i = begin; i < end; i++) {
+                    std::copy_n(src + base[i], slab, res + i * slab);
+                }
+            } else {
+                for (size_t i = begin; i < end; i++) {
+                    for (size_t j = 0; j < slab; j++) {
+                        res[ll_t(i * plan.inner) + plan.slab_out[j]] = src[base[i] + plan.slab[j]];
+                    }
+                }
             }
-            res = array<dtype>(std::move(buf), {row, 1});
+        });
+        if (out && !direct) {
+            detail::strided_copy(plan.shape, out->data(), strides(*out), res, contiguous_strides(plan.shape));
+        }
+        if (out) {
+            return *out;
+        }
+        return result;
+    }
+
+    // a[indices] = op(a[indices], values) unbuffered, so that every repeat of an index takes effect in index order as in NumPy's ufunc.at.
+    // Indices address the flattened a for none::axis and slabs along axis otherwise, and values broadcast to the shape of a[indices].
+    // Large inputs run in parallel without changing the order in which any one element is updated: wide slabs are split across threads,
+    // sorted indices are split between runs of equal ones, which are folded in a register, and other indices of an arithmetic type
+    // update through atomic compare-and-swap when op is associative.
+    template <typename T, typename U, typename Op>
+    void ufunc_scatter(array<T>& a, const array<ll_t>& indices, const array<U>& values, const int8_t axis, Op op, const bool associative) {
+        const detail::gather_plan_t plan = detail::gather_plan(a, indices, axis);
+        const size_t count = plan.base.size, slab = plan.slab.size(), total = plan.shape.size();
+        const shape_t values_shape = values.shape();
 
+        if (!can_broadcast_shape(values_shape, plan.shape) || broadcast_shape(values_shape, plan.shape) != plan.shape) {
+            throw std::invalid_argument("Cannot broadcast values to the shape of the indexed array");
+        }
+        NUMCPP_PROFILE_SCOPE(ufunc_scatter, total, total * (sizeof(T) + sizeof(U)) + count * sizeof(ll_t), total * sizeof(T));
+        detail::fp_scope_t fp_errors(!std::is_same_v<T, bool>);
+        buffer_t<T> vals(total);
+        T* v = vals.data();
+        T* dst = a.data();
+        const U* src = values.data();
+        const ll_t* base = plan.base.data();
+
+        detail::strided_loop<2>(plan.shape, {contiguous_strides(plan.shape), detail::broadcast_strides(values_shape, strides(values), plan.shape)},
+                                [&](const auto& pos, const size_t n, const auto& step) {
+                                    for (size_t k = 0; k < n; k++) {
+                                        v[pos[0] + ll_t(k) * step[0]] = static_cast<T>(src[pos[1] + ll_t(k) * step[1]]);
+                                    }
+                                });
+        // Applies the updates of indices [begin, end), folding each run of a repeated index in a register.
+        auto update_span = [&](const size_t begin, const size_t end) {
+            for (size_t i = begin; i < end;) {
+                size_t stop = i + 1;
+
+                while (stop < end && base[stop] == base[i]) {
+                    stop++;
+                }
+                if (stop == i + 1 && plan.contiguous) {
+                    T* row = dst + base[i];
+                    const T* update = v + i * slab;
+
+                    for (size_t j = 0; j < slab; j++) {
+                        row[j] = op(row[j], update[j]);
+                    }
+                } else {
+                    for (size_t j = 0; j < slab; j++) {
+                        T& target = dst[base[i] + plan.slab[j]];
+                        T acc = target;
+
+                        for (size_t r = i; r < stop; r++) {
+                            acc = op(acc, v[ll_t(r * plan.inner) + plan.slab_out[j]]);
+                        }
+                        target = acc;
+                    }
+                }
+                i = stop;
+            }
+        };
+        const bool parallel = total >= detail::parallel_scatter_size && get_num_threads() > 1;
+        const size_t grain = detail::parallel_scatter_size / slab + 1;
+
+        if (parallel && slab >= detail::parallel_slab_size) {
+            detail::parallel_for(slab, detail::parallel_slab_size / 4, [&](const size_t begin, const size_t end) {
+                for (size_t i = 0; i < count; i++) {
+                    T* row = dst + base[i];
+                    const T* update = v + i * plan.inner;
+
+                    for (size_t j = begin; j < end; j++) {
+                        row[plan.slab[j]] = op(row[plan.slab[j]], update[plan.slab_out[j]]);
+                    }
+                }
+            });
+        } else if (parallel && plan.sorted) {
+            // Chunk bounds move forward to the next change of index, so no element is updated from two threads.
+            detail::parallel_for(count, grain, [&](size_t begin, size_t end) {
+                while (begin > 0 && begin < count && base[begin] == base[begin - 1]) {
+                    begin++;
+                }
+                while (end < count && base[end] == base[end - 1]) {
+                    end++;
+                }
+                update_span(begin, end);
+            });
+        } else if (parallel && associative && detail::has_atomic_update_v<T>) {
+            if constexpr (detail::has_atomic_update_v<T>) {
+                detail::parallel_for(count, grain, [&](const size_t begin, const size_t end) {
+                    for (size_t i = begin; i < end; i++) {
+                        for (size_t j = 0; j < slab; j++) {
+                            std::atomic_ref<T> target(dst[base[i] + plan.slab[j]]);
+                            const T update = v[ll_t(i * plan.inner) + plan.slab_out[j]];
+                            T expected = target.load(std::memory_order_relaxed);
+
+                            while (!target.compare_exchange_weak(expected, op(expected, update), std::memory_order_relaxed)) {
+                            }
+                        }
+                    }
+                });
+            }
         } else {
-            throw std::invalid_argument("other axes are not suppoerted");
+            update_span(0, count);
+        }
+        fp_errors.report();
+    }
+
+    namespace detail {
+        // Samples from which ufunc_histogram counts in parallel, each thread taking at least this many.
+        inline constexpr size_t parallel_histogram_size = size_t(1) << 16;
+        // Bin count below which ufunc_histogram keeps four interleaved copies of each private histogram, so that consecutive samples
+        // in the same bin update different counters rather than wait on each other's store.
+        inline constexpr size_t histogram_lane_bins = size_t(1) << 12;
+        // Samples binned at a time, ahead of counting them.
+        inline constexpr size_t histogram_block = 256;
+
+        // Bins of equal width over [lo, hi]. A sample's bin is its offset times the precomputed bins / (hi - lo), moved by one where
+        // rounding put it on the wrong side of an edge so that bins agree with `edges`; hi falls in the last bin and samples outside
+        // the range or NaN in the overflow bin `bins`.
+        template <typename E>
+        struct uniform_bins_t {
+            using value_type = E;
+            array<E> edges;
+            const E* edge;
+            E lo, hi, scale;
+            size_t bins;
+
+            uniform_bins_t(const size_t count, const E first, const E last) :
+                lo(first == last ? first - E(0.5) : first), hi(first == last ? last + E(0.5) : last), bins(count) {
+                if (bins == 0) {
+                    throw std::invalid_argument("`bins` must be positive");
+                }
+                if (!std::isfinite(first) || !std::isfinite(last)) {
+                    throw std::invalid_argument("range of [" + std::to_string(first) + ", " + std::to_string(last) + "] is not finite");
+                }
+                if (first > last) {
+                    throw std::invalid_argument("max must be larger than min in range parameter");
+                }
+                edges = space_t<E>(lo, hi, bins + 1);
+                edge = edges.data();
+                scale = E(bins) / (hi - lo);
+            }
+            uniform_bins_t(const uniform_bins_t&) = delete;
+
+            // Writes the bins of the m samples at data to out.
+            template <typename T>
+            void operator()(const T* data, const size_t m, size_t* out) const noexcept {
+                for (size_t j = 0; j < m; j++) {
+                    const E value = E(data[j]);
+                    const bool inside = std::isgreaterequal(value, lo) && std::islessequal(value, hi);
+                    const E x = inside ? value : lo;
+                    const size_t bin = std::min(size_t(ll_t((x - lo) * scale)), bins - 1);
+                    out[j] = inside ? bin - (x < edge[bin]) + (bin + 1 < bins && x >= edge[bin + 1]) : bins;
+                }
+            }
+        };
+
+        // Bins between consecutive given edges, found by a binary search whose steps are a compare and a multiply-add rather than a
+        // branch; the last bin includes its right edge and samples outside the edges or NaN fall in the overflow bin `bins`.
+        template <typename E>
+        struct edge_bins_t {
+            using value_type = E;
+            array<E> edges;
+            const E* edge;
+            size_t bins;
+
+            explicit edge_bins_t(const array<E>& given) :
+                edges(is_contiguous(given.shape(), strides(given)) ? given : given.copy()), edge(edges.data()), bins(edges.size() - 1) {
+                if (edges.size() < 2) {
+                    throw std::invalid_argument("`bins` must hold at least two edges");
+                }
+                for (size_t i = 0; i < bins; i++) {
+                    if (!std::islessequal(edge[i], edge[i + 1])) {
+                        throw std::invalid_argument("`bins` must increase monotonically");
+                    }
+                }
+            }
+            edge_bins_t(const edge_bins_t&) = delete;
+
+            // Writes the bins of the m <= histogram_block samples at data to out. The searches of a block advance together a step at a
+            // time, so that the loads of one step for different samples overlap instead of each search waiting on its previous load.
+            template <typename T>
+            void operator()(const T* data, const size_t m, size_t* out) const noexcept {
+                E x[histogram_block];
+                bool inside[histogram_block];
+
+                for (size_t j = 0; j < m; j++) {
+                    const E value = E(data[j]);
+                    inside[j] = std::isgreaterequal(value, edge[0]) && std::islessequal(value, edge[bins]);
+                    x[j] = inside[j] ? value : edge[0];
+                    out[j] = 0;
+                }
+                for (size_t len = bins + 1; len > 1; len -= len / 2) {
+                    const size_t half = len / 2;
+
+                    for (size_t j = 0; j < m; j++) {
+                        out[j] += size_t(edge[out[j] + half] <= x[j]) * half;
+                    }
+                }
+                for (size_t j = 0; j < m; j++) {
+                    out[j] = inside[j] ? std::min(out[j], bins - 1) : bins;
+                }
+            }
+        };
+
+        // Range of n samples for automatically placed bins, [0, 1] when there are none.
+        template <typename E, typename T>
+        std::pair<E, E> sample_range(const T* data, const size_t n) {
+            if (n == 0) {
+                return {E(0), E(1)};
+            }
+            T lo = data[0], hi = data[0];
+            bool finite = true;
+
+            for (size_t i = 1; i < n; i++) {
+                lo = data[i] < lo ? data[i] : lo;
+                hi = data[i] > hi ? data[i] : hi;
+            }
+            if constexpr (is_floating_point_v<T>) {
+                for (size_t i = 0; i < n; i++) {
+                    finite &= std::isfinite(data[i]);
+                }
+            }
+            if (!finite) {
+                throw std::invalid_argument("autodetected range of the samples is not finite");
+            }
+            return {E(lo), E(hi)};
+        }
+
+        // Bins of bincount over the n non-negative integers at data: one past the largest, and at least minlength.
+        template <typename T>
+        shape_t bincount_shape(const T* data, const size_t n, const size_t minlength) {
+            T lo = T(), hi = T();
+
+            for (size_t i = 0; i < n; i++) {
+                lo = data[i] < lo ? data[i] : lo;
+                hi = data[i] > hi ? data[i] : hi;
+            }
+            if constexpr (T(-1) < T()) {
+                if (lo < T()) {
+                    throw std::invalid_argument("`x` must have no negative elements");
+                }
+            }
+            return std::max(n ? size_t(hi) + 1 : 0, minlength);
+        }
+    } // namespace detail
+
+    // Histogram of shape `shape` summing weight(i) into the bin of each sample i in [0, n), bin(i, m, out) writing the bins of the m
+    // samples from i to out and bin `shape.size()` dropping a sample. Each thread counts a chunk of the samples into a private histogram
+    // and the partial histograms are summed in chunk order after all threads finish, so no counter is shared in the counting loop and
+    // the result does not depend on thread timing.
+    template <typename H, typename Bin, typename Weight>
+    array<H> ufunc_histogram(const size_t n, [[maybe_unused]] const size_t sample_bytes, const shape_t& shape, Bin bin, Weight weight) {
+        const size_t bins = shape.size(), stride = bins + 1, lanes = bins < detail::histogram_lane_bins ? 4 : 1;
+        NUMCPP_PROFILE_SCOPE(ufunc_histogram, n, n * sample_bytes, bins * sizeof(H));
+        std::vector<std::pair<size_t, buffer_t<H>>> partials;
+        std::mutex mutex;
+
+        detail::parallel_for(n, std::max(detail::parallel_histogram_size, lanes * stride), [&](const size_t begin, const size_t end) {
+            buffer_t<H> local(lanes * stride);
+            H* h = local.data();
+            size_t block[detail::histogram_block];
+
+            for (size_t i = begin; i < end; i += detail::histogram_block) {
+                const size_t m = std::min(detail::histogram_block, end - i);
+                size_t k = 0;
+
+                bin(i, m, block);
+                if (lanes == 4) {
+                    for (; k + 4 <= m; k += 4) {
+                        h[block[k]] += weight(i + k);
+                        h[stride + block[k + 1]] += weight(i + k + 1);
+                        h[2 * stride + block[k + 2]] += weight(i + k + 2);
+                        h[3 * stride + block[k + 3]] += weight(i + k + 3);
+                    }
+                }
+                for (; k < m; k++) {
+                    h[block[k]] += weight(i + k);
+                }
+            }
+            for (size_t lane = 1; lane < lanes; lane++) {
+                for (size_t j = 0; j < bins; j++) {
+                    h[j] += h[lane * stride + j];
+                }
+            }
+            const std::lock_guard lock(mutex);
+            partials.emplace_back(begin, std::move(local));
+        });
+        std::sort(partials.begin(), partials.end(), [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+        array<H> result(buffer_t<H>(bins), shape);
+        H* res = result.data();
+
+        for (const auto& [begin, local] : partials) {
+            const H* h = local.data();
+
+            for (size_t j = 0; j < bins; j++) {
+                res[j] += h[j];
+            }
         }
-        return keepdims ? res[slice_t()] : res;
+        return result;
+    }
+
+    namespace detail {
+        // Counts of the pairs (x[i], y[i]) of two contiguous arrays of samples in the grid of the bins of x by the bins of y.
+        template <typename T, typename XBins, typename YBins>
+        array<int64_t> histogram2d(const array<T>& x, const array<T>& y, const XBins& x_bin, const YBins& y_bin) {
+            const size_t x_bins = x_bin.bins, y_bins = y_bin.bins;
+            const T *xs = x.data(), *ys = y.data();
+
+            return ufunc_histogram<int64_t>(
+                x.size(), 2 * sizeof(T), shape_t({x_bins, y_bins}),
+                [&](const size_t i, const size_t m, size_t* out) {
+                    size_t y_out[histogram_block];
+                    x_bin(xs + i, m, out);
+                    y_bin(ys + i, m, y_out);
+
+                    for (size_t j = 0; j < m; j++) {
+                        out[j] = out[j] < x_bins && y_out[j] < y_bins ? out[j] * y_bins + y_out[j] : x_bins * y_bins;
+                    }
+                },
+                [](size_t) { return int64_t(1); });
+        }
+
+        // Shape left by reducing `axis` of `shape`, kept as an extent of one with keepdims.
+        inline shape_t reduced_shape(const shape_t& shape, const int8_t axis, const bool keepdims) {
+            size_t dims[shape_t::max_ndim], n = 0;
+
+            for (size_t d = 0; d < shape.ndim; d++) {
+                if (axis == none::axis || d == size_t(axis)) {
+                    if (keepdims) {
+                        dims[n++] = 1;
+                    }
+                } else {
+                    dims[n++] = shape[d];
+                }
+            }
+            return n ? shape_t(dims, n) : shape_t(1);
+        }
+
+        // Calls lane(index) with a view index selecting every 1-D lane along `axis`, in row-major order of the other axes.
+        template <typename Lane>
+        void for_each_lane(const shape_t& shape, const size_t axis, Lane lane) {
+            ll_t indices[shape_t::max_ndim] = {};
+            size_t lanes = 1;
+
+            for (size_t d = 0; d < shape.ndim; d++) {
+                lanes *= d == axis ? 1 : shape[d];
+            }
+            for (size_t i = 0; i < lanes; i++) {
+                index_t index(indices, shape.ndim);
+                index.set(axis, slice_t());
+                lane(index, i);
+
+                for (ll_t d = shape.ndim - 1; d >= 0; d--) {
+                    if (size_t(d) != axis && ++indices[d] < ll_t(shape[d])) {
+                        break;
+                    }
+                    if (size_t(d) != axis) {
+                        indices[d] = 0;
+                    }
+                }
+            }
+        }
+
+        inline constexpr size_t parallel_reduce_bytes = size_t(1) << 22;
+        // Upper bound on the blocks of a deterministic reduction, each holding a partial result.
+        inline constexpr size_t deterministic_reduce_blocks = 64;
+
+        // Reduction whose values are the result type itself: lift converts an element, op merges two values associatively with identity
+        // as its neutral element and every result starts at initial. Reducers with other value types also provide finish(value).
+        template <typename Value, typename Op>
+        struct reducer_t {
+            using value_type = Value;
+            Op op;
+            Value identity, initial;
+
+            template <typename T>
+            NUMCPP_ALWAYS_INLINE Value lift(const T& x) const noexcept {
+                return static_cast<Value>(x);
+            }
+            NUMCPP_ALWAYS_INLINE Value operator()(const Value& a, const Value& b) const noexcept { return op(a, b); }
+        };
+
+        // Number of selected elements.
+        template <typename Value>
+        struct count_reducer_t {
+            using value_type = Value;
+            Value identity = Value(0), initial = Value(0);
+
+            template <typename T>
+            NUMCPP_ALWAYS_INLINE Value lift(const T&) const noexcept {
+                return Value(1);
+            }
+            NUMCPP_ALWAYS_INLINE Value operator()(const Value& a, const Value& b) const noexcept { return a + b; }
+        };
+
+        // Number of nonzero elements.
+        template <typename Value>
+        struct nonzero_reducer_t {
+            using value_type = Value;
+            Value identity = Value(0), initial = Value(0);
+
+            template <typename T>
+            NUMCPP_ALWAYS_INLINE Value lift(const T& x) const noexcept {
+                return Value(x != T(0));
+            }
+            NUMCPP_ALWAYS_INLINE Value operator()(const Value& a, const Value& b) const noexcept { return a + b; }
+        };
+
+        // Compensated sum: every merge adds the exact rounding error of its addition, found by Knuth's branch-free TwoSum, to a running
+        // error term that finish adds back. This is Neumaier's correction, and stays exact however the values are ordered.
+        template <typename T>
+        struct compensated_sum_t {
+            struct value_type {
+                T sum, error;
+            };
+            value_type identity = {T(0), T(0)}, initial = {T(0), T(0)};
+
+            template <typename U>
+            NUMCPP_ALWAYS_INLINE value_type lift(const U& x) const noexcept {
+                return {static_cast<T>(x), T(0)};
+            }
+            NUMCPP_ALWAYS_INLINE value_type operator()(const value_type& a, const value_type& b) const noexcept {
+                const T sum = a.sum + b.sum, b_part = sum - a.sum;
+                return {sum, (a.error + b.error) + ((a.sum - (sum - b_part)) + (b.sum - b_part))};
+            }
+            template <typename dtype>
+            dtype finish(const value_type& value) const noexcept {
+                return static_cast<dtype>(value.sum + value.error);
+            }
+        };
+
+        // Count, mean and sum of squared deviations, merged with Chan's formula. Merging a single element is Welford's update, so the
+        // variance takes one pass without the cancellation of the textbook sum of squares.
+        template <typename T>
+        struct moments_t {
+            struct value_type {
+                T count, mean, m2;
+            };
+            value_type identity = {T(0), T(0), T(0)}, initial = {T(0), T(0), T(0)};
+            T ddof = 0;
+            bool root = false;
+
+            template <typename U>
+            NUMCPP_ALWAYS_INLINE value_type lift(const U& x) const noexcept {
+                return {T(1), static_cast<T>(x), T(0)};
+            }
+            NUMCPP_ALWAYS_INLINE value_type operator()(const value_type& a, const value_type& b) const noexcept {
+                const T count = a.count + b.count, delta = b.mean - a.mean, weight = b.count / (count + T(count == 0));
+                return {count, a.mean + delta * weight, (a.m2 + b.m2) + delta * delta * a.count * weight};
+            }
+            template <typename dtype>
+            dtype finish(const value_type& value) const noexcept {
+                const T variance = value.m2 / std::max(value.count - ddof, T(0));
+                return static_cast<dtype>(root ? std::sqrt(variance) : variance);
+            }
+        };
+
+        // Strides of the reduction result `res` indexed by positions of the reduced array of `shape`: zero along the reduced axes.
+        template <typename T>
+        strides_t reduction_strides(const array<T>& res, const shape_t& shape, const int8_t axis) {
+            const shape_t keep_shape = reduced_shape(shape, axis, true);
+            strides_t res_strides = {};
+
+            if (res.size() && reshape_strides(res.shape(), strides(res), keep_shape, order_t::C, res_strides)) {
+                for (size_t d = 0; d < shape.ndim; d++) {
+                    res_strides[d] = keep_shape[d] == 1 ? 0 : res_strides[d];
+                }
+            }
+            return res_strides;
+        }
+
+        template <typename Reducer>
+        inline constexpr size_t reduce_lanes = std::max<size_t>(64 / sizeof(typename Reducer::value_type), 8);
+
+        // Folds n <= 128 * lanes elements into one value with `lanes` independent accumulators, so that ops the compiler may not
+        // reassociate (a NaN-propagating max, a floating-point sum) still vectorize. Unselected elements read as identity.
+        template <bool masked, typename T, typename SrcStep, typename Mask, typename MaskStep, typename Reducer>
+        NUMCPP_ALWAYS_INLINE typename Reducer::value_type reduce_block(const T* src, const SrcStep src_step, const Mask mask,
+                                                                       const MaskStep mask_step, const size_t n, const Reducer& reducer) {
+            using value_t = typename Reducer::value_type;
+            constexpr size_t lanes = reduce_lanes<Reducer>;
+            auto load = [&](const size_t k) {
+                if constexpr (masked) {
+                    return mask[ll_t(k) * mask_step] ? reducer.lift(src[ll_t(k) * src_step]) : reducer.identity;
+                } else {
+                    return reducer.lift(src[ll_t(k) * src_step]);
+                }
+            };
+            value_t acc[lanes];
+            std::fill_n(acc, lanes, reducer.identity);
+            size_t k = 0;
+
+            for (; k + lanes <= n; k += lanes) {
+                // Kept as a loop so that it vectorizes as an elementwise op; fully unrolled it leaves `lanes` scalar reductions.
+#pragma GCC unroll 1
+                for (size_t j = 0; j < lanes; j++) {
+                    acc[j] = reducer(acc[j], load(k + j));
+                }
+            }
+            for (; k < n; k++) {
+                acc[0] = reducer(acc[0], load(k));
+            }
+            for (size_t j = 1; j < lanes; j++) {
+                acc[0] = reducer(acc[0], acc[j]);
+            }
+            return acc[0];
+        }
+
+        // Pairwise reduction of a run as in NumPy: halves are reduced separately down to blocks of 128 elements per lane, so the rounding
+        // error of a sum grows with the logarithm of n rather than with n.
+        template <bool masked, typename T, typename SrcStep, typename Mask, typename MaskStep, typename Reducer>
+        typename Reducer::value_type reduce_run(const T* src, const SrcStep src_step, const Mask mask, const MaskStep mask_step, const size_t n,
+                                                const Reducer& reducer) {
+            constexpr size_t lanes = reduce_lanes<Reducer>;
+
+            if (n <= 128 * lanes) {
+                return reduce_block<masked>(src, src_step, mask, mask_step, n, reducer);
+            }
+            const size_t half = n / 2 - n / 2 % lanes;
+            return reducer(reduce_run<masked>(src, src_step, mask, mask_step, half, reducer),
+                           reduce_run<masked>(src + ll_t(half) * src_step, src_step, masked ? mask + ll_t(half) * mask_step : mask, mask_step,
+                                              n - half, reducer));
+        }
+
+        // Folds the (shape, src_strides) elements into res, whose strides are zero along the reduced axes. Innermost runs along a reduced
+        // axis go through reduce_run, the others update a row of results elementwise. Mask is `const bool*` or bit_reader_t.
+        template <bool masked, typename T, typename Mask, typename Reducer>
+        void reduce_serial(const shape_t& shape, const T* src, const strides_t& src_strides, typename Reducer::value_type* res,
+                           const strides_t& res_strides, const Mask mask, const strides_t& mask_strides, const Reducer& reducer) {
+            using unit_step_t = std::integral_constant<ll_t, 1>;
+            auto kernel = [&](const auto& pos, const size_t n, const auto& step) {
+                Mask mask_ptr = Mask();
+                ll_t mask_step = 0;
+
+                if constexpr (masked) {
+                    mask_ptr = mask + pos[2];
+                    mask_step = step[2];
+                }
+                if (step[1] == 0) {
+                    res[pos[1]] = reducer(res[pos[1]], step[0] == 1 && (!masked || mask_step == 1)
+                                                           ? reduce_run<masked>(src + pos[0], unit_step_t(), mask_ptr, unit_step_t(), n, reducer)
+                                                           : reduce_run<masked>(src + pos[0], step[0], mask_ptr, mask_step, n, reducer));
+                } else {
+                    for (size_t k = 0; k < n; k++) {
+                        auto& target = res[pos[1] + ll_t(k) * step[1]];
+
+                        if constexpr (masked) {
+                            target = reducer(target, mask_ptr[ll_t(k) * step[2]] ? reducer.lift(src[pos[0] + ll_t(k) * step[0]]) : reducer.identity);
+                        } else {
+                            target = reducer(target, reducer.lift(src[pos[0] + ll_t(k) * step[0]]));
+                        }
+                    }
+                }
+            };
+
+            if constexpr (masked) {
+                strided_loop<3>(shape, {src_strides, res_strides, mask_strides}, kernel);
+            } else {
+                strided_loop<2>(shape, {src_strides, res_strides}, kernel);
+            }
+        }
+
+        // reduce_serial split across threads along the slowest axis of the source once it holds parallel_reduce_bytes. Chunks of a kept axis
+        // write disjoint results; chunks of a reduced axis fold into private partial results that are merged into res under a lock, or in
+        // deterministic mode into up to deterministic_reduce_blocks fixed blocks merged by a pairwise tree.
+        template <typename T, typename Mask, typename Reducer>
+        void reduce(const shape_t& shape, const T* src, const strides_t& src_strides, typename Reducer::value_type* res, const strides_t& res_strides,
+                    const Mask mask, const strides_t& mask_strides, const Reducer& reducer) {
+            using value_t = typename Reducer::value_type;
+            auto serial = [&](const shape_t& part, const ll_t offset, const ll_t mask_offset, value_t* part_res, const strides_t& part_strides) {
+                if (mask) {
+                    reduce_serial<true>(part, src + offset, src_strides, part_res, part_strides, mask + mask_offset, mask_strides, reducer);
+                } else {
+                    reduce_serial<false>(part, src + offset, src_strides, part_res, part_strides, mask, mask_strides, reducer);
+                }
+            };
+            size_t axis = shape.ndim;
+
+            for (size_t d = 0; d < shape.ndim; d++) {
+                if (shape[d] > 1 && (axis == shape.ndim || std::abs(src_strides[d]) > std::abs(src_strides[axis]))) {
+                    axis = d;
+                }
+            }
+            if (shape.size() * sizeof(T) < parallel_reduce_bytes || axis == shape.ndim) {
+                serial(shape, 0, 0, res, res_strides);
+                return;
+            }
+            const size_t grain = parallel_reduce_bytes / 4 / (shape.size() / shape[axis] * sizeof(T)) + 1;
+
+            if (res_strides[axis] != 0) {
+                parallel_for(shape[axis], grain, [&](const size_t begin, const size_t end) {
+                    shape_t part = shape;
+                    part[axis] = end - begin;
+                    serial(part, ll_t(begin) * src_strides[axis], ll_t(begin) * mask_strides[axis], res + ll_t(begin) * res_strides[axis],
+                           res_strides);
+                });
+                return;
+            }
+            shape_t res_shape = shape;
+
+            for (size_t d = 0; d < shape.ndim; d++) {
+                res_shape[d] = res_strides[d] == 0 ? 1 : shape[d];
+            }
+            strides_t partial_strides = contiguous_strides(res_shape);
+
+            for (size_t d = 0; d < shape.ndim; d++) {
+                partial_strides[d] = res_strides[d] == 0 ? 0 : partial_strides[d];
+            }
+            auto merge = [&](const value_t* partial) {
+                strided_loop<2>(res_shape, {res_strides, partial_strides}, [&](const auto& pos, const size_t n, const auto& step) {
+                    for (size_t k = 0; k < n; k++) {
+                        res[pos[0] + ll_t(k) * step[0]] = reducer(res[pos[0] + ll_t(k) * step[0]], partial[pos[1] + ll_t(k) * step[1]]);
+                    }
+                });
+            };
+
+            if (get_reduction_mode() == reduction_mode_t::fast) {
+                std::mutex mutex;
+                parallel_for(shape[axis], grain, [&](const size_t begin, const size_t end) {
+                    std::vector<value_t> partial(res_shape.size(), reducer.identity);
+                    shape_t part = shape;
+                    part[axis] = end - begin;
+                    serial(part, ll_t(begin) * src_strides[axis], ll_t(begin) * mask_strides[axis], partial.data(), partial_strides);
+
+                    const std::lock_guard lock(mutex);
+                    merge(partial.data());
+                });
+                return;
+            }
+            // The blocks depend only on the shape, and their partials are merged pairwise in the same order whichever thread made them.
+            const size_t blocks = std::clamp<size_t>(shape[axis] / grain, 1, deterministic_reduce_blocks), partial_size = res_shape.size();
+            std::vector<value_t> partials(blocks * partial_size, reducer.identity);
+            parallel_for(blocks, 1, [&](const size_t begin, const size_t end) {
+                for (size_t b = begin; b < end; b++) {
+                    const size_t first = shape[axis] * b / blocks;
+                    shape_t part = shape;
+                    part[axis] = shape[axis] * (b + 1) / blocks - first;
+                    serial(part, ll_t(first) * src_strides[axis], ll_t(first) * mask_strides[axis], partials.data() + b * partial_size,
+                           partial_strides);
+                }
+            });
+            parallel_for(partial_size, parallel_reduce_bytes / 4 / (blocks * sizeof(value_t)) + 1, [&](const size_t begin, const size_t end) {
+                for (size_t width = 1; width < blocks; width *= 2) {
+                    for (size_t b = 0; b + width < blocks; b += 2 * width) {
+                        value_t* lhs = partials.data() + b * partial_size;
+                        const value_t* rhs = lhs + width * partial_size;
+
+                        for (size_t k = begin; k < end; k++) {
+                            lhs[k] = reducer(lhs[k], rhs[k]);
+                        }
+                    }
+                }
+            });
+            merge(partials.data());
+        }
+
+        // Inclusive scan of a run, res[k] = op(res[k - 1], src[k]). For an associative op each block of `width` elements is scanned on its
+        // own, then offset by the running total, so the chain of dependent ops advances a block per op and the local scans of later blocks
+        // overlap with it.
+        template <typename T, typename dtype, typename SrcStep, typename ResStep, typename Op>
+        void scan_run(const T* src, const SrcStep src_step, dtype* res, const ResStep res_step, const size_t n, Op op, const bool associative) {
+            constexpr size_t width = 8;
+
+            if (n == 0) {
+                return;
+            }
+            dtype carry = static_cast<dtype>(src[0]);
+            res[0] = carry;
+            size_t k = 1;
+
+            for (; associative && k + width <= n; k += width) {
+                dtype local[width];
+                local[0] = static_cast<dtype>(src[ll_t(k) * src_step]);
+
+                for (size_t i = 1; i < width; i++) {
+                    local[i] = op(local[i - 1], static_cast<dtype>(src[ll_t(k + i) * src_step]));
+                }
+                for (size_t i = 0; i < width; i++) {
+                    res[ll_t(k + i) * res_step] = op(carry, local[i]);
+                }
+                carry = op(carry, local[width - 1]);
+            }
+            for (; k < n; k++) {
+                carry = op(carry, static_cast<dtype>(src[ll_t(k) * src_step]));
+                res[ll_t(k) * res_step] = carry;
+            }
+        }
+
+        // Scans `axis` of the (shape, src_strides) elements into res. Along the innermost axis each lane goes through scan_run; along an outer
+        // axis whole rows are combined elementwise with the previous row, which vectorizes over the inner axes.
+        template <typename T, typename dtype, typename Op>
+        void scan_serial(const shape_t& shape, const T* src, const strides_t& src_strides, dtype* res, const strides_t& res_strides,
+                         const size_t axis, Op op, const bool associative) {
+            using unit_step_t = std::integral_constant<ll_t, 1>;
+            shape_t lane_shape = shape;
+            lane_shape[axis] = 1;
+            bool innermost = true;
+
+            for (size_t d = 0; d < shape.ndim; d++) {
+                innermost &= d == axis || shape[d] == 1 || std::abs(src_strides[d]) > std::abs(src_strides[axis]);
+            }
+            if (innermost) {
+                strided_loop<2>(lane_shape, {src_strides, res_strides}, [&](const auto& pos, const size_t n, const auto& step) {
+                    for (size_t k = 0; k < n; k++) {
+                        const T* lane_src = src + pos[0] + ll_t(k) * step[0];
+                        dtype* lane_res = res + pos[1] + ll_t(k) * step[1];
+
+                        if (src_strides[axis] == 1 && res_strides[axis] == 1) {
+                            scan_run(lane_src, unit_step_t(), lane_res, unit_step_t(), shape[axis], op, associative);
+                        } else {
+                            scan_run(lane_src, src_strides[axis], lane_res, res_strides[axis], shape[axis], op, associative);
+                        }
+                    }
+                });
+                return;
+            }
+            for (size_t i = 0; i < shape[axis]; i++) {
+                const T* row_src = src + ll_t(i) * src_strides[axis];
+                dtype* row = res + ll_t(i) * res_strides[axis];
+
+                if (i == 0) {
+                    strided_loop<2>(lane_shape, {res_strides, src_strides}, [&](const auto& pos, const size_t n, const auto& step) {
+                        for (size_t k = 0; k < n; k++) {
+                            row[pos[0] + ll_t(k) * step[0]] = static_cast<dtype>(row_src[pos[1] + ll_t(k) * step[1]]);
+                        }
+                    });
+                    continue;
+                }
+                const dtype* prev = row - res_strides[axis];
+                strided_loop<2>(lane_shape, {res_strides, src_strides}, [&](const auto& pos, const size_t n, const auto& step) {
+                    for (size_t k = 0; k < n; k++) {
+                        row[pos[0] + ll_t(k) * step[0]] =
+                            op(prev[pos[0] + ll_t(k) * step[0]], static_cast<dtype>(row_src[pos[1] + ll_t(k) * step[1]]));
+                    }
+                });
+            }
+        }
+
+        // scan_serial split across threads along the slowest axis of the source, as reduce does. Chunks of another axis scan disjoint lanes;
+        // chunks of the scanned axis are scanned independently, then each is offset by the running total of the blocks before it. The
+        // blocks follow the thread count in fast mode and only the shape in deterministic mode. Ops that are not associative keep the
+        // scanned axis in one piece.
+        template <typename T, typename dtype, typename Op>
+        void scan(const shape_t& shape, const T* src, const strides_t& src_strides, dtype* res, const strides_t& res_strides, const size_t axis,
+                  Op op, const bool associative) {
+            size_t split = shape.ndim;
+
+            for (size_t d = 0; d < shape.ndim; d++) {
+                if (shape[d] > 1 && (split == shape.ndim || std::abs(src_strides[d]) > std::abs(src_strides[split]))) {
+                    split = d;
+                }
+            }
+            if (shape.size() * sizeof(T) < parallel_reduce_bytes || split == shape.ndim || (split == axis && !associative)) {
+                scan_serial(shape, src, src_strides, res, res_strides, axis, op, associative);
+                return;
+            }
+            const size_t grain = parallel_reduce_bytes / 4 / (shape.size() / shape[split] * sizeof(T)) + 1;
+            auto serial = [&](const size_t d, const size_t begin, const size_t end) {
+                shape_t part = shape;
+                part[d] = end - begin;
+                scan_serial(part, src + ll_t(begin) * src_strides[d], src_strides, res + ll_t(begin) * res_strides[d], res_strides, axis, op,
+                            associative);
+            };
+
+            if (split != axis) {
+                parallel_for(shape[split], grain, [&](const size_t begin, const size_t end) { serial(split, begin, end); });
+                return;
+            }
+            const size_t n = shape[axis], blocks = get_reduction_mode() == reduction_mode_t::fast
+                ? std::clamp<size_t>(n / grain, 1, get_num_threads())
+                : std::clamp<size_t>(n / grain, 1, deterministic_reduce_blocks);
+            parallel_for(blocks, 1, [&](const size_t begin, const size_t end) {
+                for (size_t b = begin; b < end; b++) {
+                    serial(axis, n * b / blocks, n * (b + 1) / blocks);
+                }
+            });
+            if (blocks == 1) {
+                return;
+            }
+            shape_t lane_shape = shape;
+            lane_shape[axis] = 1;
+            strides_t carry_strides = contiguous_strides(lane_shape);
+            carry_strides[axis] = 0;
+            const size_t lane_size = lane_shape.size();
+            std::vector<dtype> carries((blocks - 1) * lane_size);
+
+            for (size_t b = 1; b < blocks; b++) {
+                dtype* carry = carries.data() + (b - 1) * lane_size;
+                const dtype* last = res + ll_t(n * b / blocks - 1) * res_strides[axis];
+                strided_loop<2>(lane_shape, {carry_strides, res_strides}, [&](const auto& pos, const size_t len, const auto& step) {
+                    for (size_t k = 0; k < len; k++) {
+                        const dtype& total = last[pos[1] + ll_t(k) * step[1]];
+                        carry[pos[0] + ll_t(k) * step[0]] = b == 1 ? total : op(carry[pos[0] + ll_t(k) * step[0] - ll_t(lane_size)], total);
+                    }
+                });
+            }
+            parallel_for(blocks - 1, 1, [&](const size_t begin, const size_t end) {
+                for (size_t b = begin + 1; b <= end; b++) {
+                    const size_t first = n * b / blocks;
+                    const dtype* carry = carries.data() + (b - 1) * lane_size;
+                    dtype* block = res + ll_t(first) * res_strides[axis];
+                    shape_t part = shape;
+                    part[axis] = n * (b + 1) / blocks - first;
+                    strided_loop<2>(part, {res_strides, carry_strides}, [&](const auto& pos, const size_t len, const auto& step) {
+                        for (size_t k = 0; k < len; k++) {
+                            block[pos[0] + ll_t(k) * step[0]] = op(carry[pos[1] + ll_t(k) * step[1]], block[pos[0] + ll_t(k) * step[0]]);
+                        }
+                    });
+                }
+            });
+        }
+
+        // Left fold along `axis` in index order for ops that may not be reassociated: each lane of res gets op(...op(first, src[1])...),
+        // where first is op(*initial, src[0]) given an initial value and src[0] otherwise.
+        template <typename T, typename dtype, typename Op>
+        void fold(const shape_t& shape, const T* src, const strides_t& src_strides, dtype* res, const strides_t& res_strides, const size_t axis,
+                  const dtype* initial, Op op) {
+            shape_t lane_shape = shape;
+            lane_shape[axis] = 1;
+            strided_loop<2>(lane_shape, {src_strides, res_strides}, [&](const auto& pos, const size_t n, const auto& step) {
+                for (size_t k = 0; k < n; k++) {
+                    const T* lane = src + pos[0] + ll_t(k) * step[0];
+                    size_t i = initial ? 0 : 1;
+                    dtype acc = initial ? *initial : static_cast<dtype>(lane[0]);
+
+                    for (; i < shape[axis]; i++) {
+                        acc = op(acc, static_cast<dtype>(lane[ll_t(i) * src_strides[axis]]));
+                    }
+                    res[pos[1] + ll_t(k) * step[1]] = acc;
+                }
+            });
+        }
+    } // namespace detail
+
+    // Reduces `axis` of arr (all axes for none::axis) with `reducer`, a detail::reducer_t or a type with the same members. Reducers whose
+    // value_type is not dtype accumulate in a separate buffer and finish(value) produces each result.
+    template <typename T, typename dtype, typename Reducer>
+    array<dtype> ufunc_reduce(const array<T>& arr, const int8_t axis, out_t<dtype> out, const bool keepdims, const where_t& where,
+                              const Reducer& reducer) {
+        using value_t = typename Reducer::value_type;
+        const shape_t arr_shape = arr.shape(), where_shape = where ? where.shape() : none::shape;
+        const int8_t ax = axis == none::axis ? none::axis : detail::normalize_axis(axis, arr_shape.ndim);
+        const shape_t res_shape = detail::reduced_shape(arr_shape, ax, keepdims);
+
+        if (out && out->shape() != res_shape) {
+            throw std::invalid_argument("Shape mis-match with out and expected out-put");
+        }
+        if (where && arr_shape != broadcast_shape(arr_shape, where_shape)) {
+            throw std::invalid_argument("Cannot broadcast where shape to array shape");
+        }
+        NUMCPP_PROFILE_SCOPE(ufunc_reduce, arr_shape.size(), arr_shape.size() * sizeof(T), res_shape.size() * sizeof(dtype));
+        detail::fp_scope_t fp_errors(!std::is_same_v<dtype, bool>);
+        array<dtype> result = out ? array<dtype>() : array<dtype>(buffer_t<dtype>(res_shape.size()), res_shape);
+        array<dtype>& target = out ? *out : result;
+        const strides_t res_strides = detail::reduction_strides(target, arr_shape, ax);
+        const strides_t mask_strides = where ? detail::broadcast_strides(where_shape, where.strides(), arr_shape) : strides_t();
+        dtype* res = target.data();
+        auto reduce_into = [&](value_t* acc, const strides_t& acc_strides) {
+            if (!where) {
+                detail::reduce(arr_shape, arr.data(), strides(arr), acc, acc_strides, static_cast<const bool*>(nullptr), mask_strides, reducer);
+                return;
+            }
+            where.visit([&](const auto mask) { detail::reduce(arr_shape, arr.data(), strides(arr), acc, acc_strides, mask, mask_strides, reducer); });
+        };
+
+        if constexpr (std::is_same_v<value_t, dtype>) {
+            detail::strided_loop<1>(res_shape, {strides(target)}, [&](const auto& pos, const size_t n, const auto& step) {
+                for (size_t k = 0; k < n; k++) {
+                    res[pos[0] + ll_t(k) * step[0]] = reducer.initial;
+                }
+            });
+            reduce_into(res, res_strides);
+        } else {
+            const shape_t keep_shape = detail::reduced_shape(arr_shape, ax, true);
+            strides_t acc_strides = contiguous_strides(keep_shape);
+            std::vector<value_t> acc(keep_shape.size(), reducer.initial);
+
+            for (size_t d = 0; d < keep_shape.ndim; d++) {
+                acc_strides[d] = keep_shape[d] == 1 ? 0 : acc_strides[d];
+            }
+            reduce_into(acc.data(), acc_strides);
+            detail::strided_loop<2>(keep_shape, {res_strides, acc_strides}, [&](const auto& pos, const size_t n, const auto& step) {
+                for (size_t k = 0; k < n; k++) {
+                    res[pos[0] + ll_t(k) * step[0]] = reducer.template finish<dtype>(acc[pos[1] + ll_t(k) * step[1]]);
+                }
+            });
+        }
+        fp_errors.report();
+        if (out) {
+            return *out;
+        }
+        return result;
+    }
+
+    namespace detail {
+        // Whether some result of reducing `axis` of arr selects no element, which a reduction with neither an identity nor an initial
+        // value cannot produce. Only a where mask costs a counting pass.
+        template <typename T>
+        bool selects_nothing(const array<T>& arr, const int8_t axis, const where_t& where) {
+            const shape_t shape = arr.shape();
+
+            if (!where) {
+                return shape.size() == 0 && (axis == none::axis || shape[normalize_axis(axis, shape.ndim)] == 0);
+            }
+            const array<int64_t> count = ufunc_reduce(arr, axis, none::out<int64_t>, false, where, count_reducer_t<int64_t>());
+            return std::find(count.data(), count.data() + count.size(), 0) != count.data() + count.size();
+        }
+    } // namespace detail
+
+    // Inclusive scan of arr along `axis`, of the flattened array for none::axis: res[k] = op(res[k - 1], arr[k]). An op that is not
+    // associative is applied strictly in index order. out may be arr itself to scan in place.
+    template <typename T, typename dtype, typename Op>
+    array<dtype> ufunc_accumulate(const array<T>& arr, const int8_t axis, out_t<dtype> out, Op op, const bool associative = true) {
+        const array<T> src = axis == none::axis ? arr.ravel() : arr;
+        const shape_t shape = src.shape();
+        const size_t ax = axis == none::axis ? shape.ndim - 1 : detail::normalize_axis(axis, shape.ndim);
+
+        if (out && out->shape() != shape) {
+            throw std::invalid_argument("Shape mis-match with out and expected out-put");
+        }
+        NUMCPP_PROFILE_SCOPE(ufunc_accumulate, shape.size(), shape.size() * sizeof(T), shape.size() * sizeof(dtype));
+        detail::fp_scope_t fp_errors(!std::is_same_v<dtype, bool>);
+        array<dtype> result = out ? array<dtype>() : array<dtype>(buffer_t<dtype>(shape.size()), shape, detail::result_order(src));
+        array<dtype>& target = out ? *out : result;
+
+        if (shape.size()) {
+            detail::scan(shape, src.data(), strides(src), target.data(), strides(target), ax, op, associative);
+        }
+        fp_errors.report();
+        if (out) {
+            return *out;
+        }
+        return result;
+    }
+
+    template <typename T, typename dtype, typename Func, typename... Args>
+    array<dtype> ufunc_axes_unary(const array<T>& arr, const int8_t axis, out_t<dtype> out, const bool keepdims, Func func, Args&&... args) {
+        const shape_t arr_shape = arr.shape();
+        const int8_t ax = axis == none::axis ? none::axis : detail::normalize_axis(axis, arr_shape.ndim);
+        const shape_t res_shape = detail::reduced_shape(arr_shape, ax, keepdims);
+        NUMCPP_PROFILE_SCOPE(ufunc_axes_unary, arr_shape.size(), arr_shape.size() * sizeof(T), res_shape.size() * sizeof(dtype));
+        detail::fp_scope_t fp_errors(!std::is_same_v<dtype, bool>);
+
+        if (out && out->shape() != res_shape) {
+            throw std::invalid_argument("Shape mis-match with out and expected out-put");
+        }
+        array<dtype> res = out ? array<dtype>() : array<dtype>(buffer_t<dtype>(res_shape.size()), res_shape);
+        dtype* ptr = out ? out->data() : res.data();
+
+        if (ax == none::axis) {
+            ptr[0] = func(arr, std::forward<Args>(args)...);
+        } else {
+            detail::for_each_lane(arr_shape, ax, [&](const index_t& index, const size_t i) {
+                ptr[i] = func(arr[index], std::forward<Args>(args)...);
+            });
+        }
+        fp_errors.report();
+        if (out) {
+            return *out;
+        }
+        return res;
     }
 
     template <typename L, typename R, typename dtype, typename Func, typename... Args>
@@ -100,40 +1406,296 @@ namespace numcpp {
         if (lhs.shape() != rhs.shape()) {
             throw std::invalid_argument("currently no broadcasting allowed");
         }
-        auto [row, col] = lhs.shape();
-        buffer_t<dtype> buf;
-        array<dtype> res;
+        const shape_t arr_shape = lhs.shape();
+        const int8_t ax = axis == none::axis ? none::axis : detail::normalize_axis(axis, arr_shape.ndim);
+        const shape_t res_shape = detail::reduced_shape(arr_shape, ax, keepdims);
+        NUMCPP_PROFILE_SCOPE(ufunc_axes_binary, arr_shape.size(), arr_shape.size() * (sizeof(L) + sizeof(R)), res_shape.size() * sizeof(dtype));
+        detail::fp_scope_t fp_errors(!std::is_same_v<dtype, bool>);
 
-        if (axis == none::axis) {
-            if (out && out->shape() != shape_t(1)) {
-                throw std::invalid_argument("Shape mis-match with out and expected out-put");
+        if (out && out->shape() != res_shape) {
+            throw std::invalid_argument("Shape mis-match with out and expected out-put");
+        }
+        array<dtype> res = out ? array<dtype>() : array<dtype>(buffer_t<dtype>(res_shape.size()), res_shape);
+        dtype* ptr = out ? out->data() : res.data();
+
+        if (ax == none::axis) {
+            ptr[0] = func(lhs, rhs, std::forward<Args>(args)...);
+        } else {
+            detail::for_each_lane(arr_shape, ax, [&](const index_t& index, const size_t i) {
+                ptr[i] = func(lhs[index], rhs[index], std::forward<Args>(args)...);
+            });
+        }
+        fp_errors.report();
+        if (out) {
+            return *out;
+        }
+        return res;
+    }
+
+    // A binary ufunc in the style of NumPy's: callable elementwise, and with reduce, accumulate, outer, reduceat and at running on the
+    // same engines as the free functions. Reductions and scans of an associative op are reassociated across vector lanes and threads; other
+    // ops are applied in index order along a single axis.
+    template <typename Op>
+    struct binary_ufunc_t {
+        Op op;
+        identity_t identity = identity_t::none;
+        bool associative = true;
+        const char* name = "";
+
+        constexpr bool has_identity() const noexcept {
+            return identity == identity_t::zero || identity == identity_t::one || identity == identity_t::all_ones;
+        }
+
+        // Value that op leaves any other unchanged: the identity, or what maximum and minimum reduce away.
+        template <typename T>
+        constexpr T neutral() const noexcept {
+            switch (identity) {
+            case identity_t::one:
+                return T(1);
+            case identity_t::all_ones:
+                return static_cast<T>(-1);
+            case identity_t::lowest:
+                return is_floating_point_v<T> ? T(-inf) : std::numeric_limits<T>::lowest();
+            case identity_t::highest:
+                return is_floating_point_v<T> ? T(inf) : std::numeric_limits<T>::max();
+            default:
+                return T(0);
+            }
+        }
+
+        template <typename dtype>
+        constexpr auto typed() const noexcept {
+            return [op = op](const dtype& left, const dtype& right) -> dtype { return static_cast<dtype>(op(left, right)); };
+        }
+
+        template <typename T, typename U, typename dtype = promote_t<T, U>>
+        array<dtype> operator()(const array<T>& x, const array<U>& y, out_t<dtype> out = none::out<dtype>, const where_t& where = none::where) const {
+            return ufunc_binary(x, y, out, where, [op = typed<dtype>()](const T& left, const U& right) {
+                return op(static_cast<dtype>(left), static_cast<dtype>(right));
+            });
+        }
+
+        // Reduces `axis`, all axes for none::axis. Without an initial value, results start from the identity when op has one, and one
+        // that selects no element throws otherwise, as amax and amin do; an op that is not associative takes neither where nor several
+        // axes, flattening for none::axis.
+        template <typename T, typename dtype = T>
+        array<dtype> reduce(const array<T>& a, const int8_t axis = none::axis, out_t<dtype> out = none::out<dtype>, const bool keepdims = false,
+                            const std::optional<std::type_identity_t<dtype>> initial = std::nullopt, const where_t& where = none::where) const {
+            const shape_t shape = a.shape();
+
+            if (associative) {
+                if (!initial && !has_identity() && detail::selects_nothing(a, axis, where)) {
+                    throw std::invalid_argument(std::string("zero-size array to reduction operation ") + name + " which has no identity");
+                }
+                return ufunc_reduce(a, axis, out, keepdims, where,
+                                    detail::reducer_t{typed<dtype>(), neutral<dtype>(), initial.value_or(neutral<dtype>())});
+            }
+            if (where) {
+                throw std::invalid_argument(std::string("reduction operation '") + name + "' is not reorderable, so where is not supported");
             }
-            buf = out ? buffer(*out.ptr) : buffer_t<dtype>(1);
-            buf[0] = func(lhs, rhs, std::forward<Args>(args)...);
-            res = array<dtype>(std::move(buf), 1);
-        } else if (axis == 0 || axis == -2) {
-            if (out && out->shape() != shape_t(col)) {
+            const array<T> src = axis == none::axis ? a.ravel() : a;
+            const shape_t src_shape = src.shape();
+            const size_t ax = axis == none::axis ? src_shape.ndim - 1 : detail::normalize_axis(axis, src_shape.ndim);
+            const shape_t res_shape = detail::reduced_shape(shape, axis == none::axis ? none::axis : int8_t(ax), keepdims);
+
+            if (!initial && src_shape[ax] == 0) {
+                throw std::invalid_argument(std::string("zero-size array to reduction operation ") + name + " which has no identity");
+            }
+            if (out && out->shape() != res_shape) {
                 throw std::invalid_argument("Shape mis-match with out and expected out-put");
             }
-            buf = out ? buffer(*out.ptr) : buffer_t<dtype>(col);
+            NUMCPP_PROFILE_SCOPE(ufunc_reduce, shape.size(), shape.size() * sizeof(T), res_shape.size() * sizeof(dtype));
+            detail::fp_scope_t fp_errors(!std::is_same_v<dtype, bool>);
+            array<dtype> result = out ? array<dtype>() : array<dtype>(buffer_t<dtype>(res_shape.size()), res_shape);
+            array<dtype>& target = out ? *out : result;
+
+            if (res_shape.size()) {
+                detail::fold(src_shape, src.data(), strides(src), target.data(), detail::reduction_strides(target, src_shape, int8_t(ax)), ax,
+                             initial ? &*initial : nullptr, typed<dtype>());
+            }
+            fp_errors.report();
+            if (out) {
+                return *out;
+            }
+            return result;
+        }
+        template <typename dtype, typename T>
+        array<dtype> reduce(const array<T>& a, const int8_t axis = none::axis, const bool keepdims = false,
+                            const std::optional<std::type_identity_t<dtype>> initial = std::nullopt, const where_t& where = none::where) const {
+            return reduce(a, axis, none::out<dtype>, keepdims, initial, where);
+        }
+        template <typename T>
+        array<T> reduce(const array<T>& a, const int8_t axis, const bool keepdims,
+                        const std::optional<std::type_identity_t<T>> initial = std::nullopt, const where_t& where = none::where) const {
+            return reduce(a, axis, none::out<T>, keepdims, initial, where);
+        }
+
+        // Running op along `axis`, of the flattened array for none::axis.
+        template <typename T, typename dtype = T>
+        array<dtype> accumulate(const array<T>& a, const int8_t axis = none::axis, out_t<dtype> out = none::out<dtype>) const {
+            return ufunc_accumulate(a, axis, out, typed<dtype>(), associative);
+        }
+        template <typename dtype, typename T>
+        array<dtype> accumulate(const array<T>& a, const int8_t axis = none::axis) const {
+            return accumulate(a, axis, none::out<dtype>);
+        }
+
+        // op of every element of a with every element of b, shaped as the dimensions of a followed by those of b. Leading unit dimensions,
+        // which pad 1-D and 0-D arrays here, are dropped first, so two vectors give a matrix.
+        template <typename T, typename U, typename dtype = promote_t<T, U>>
+        array<dtype> outer(const array<T>& a, const array<U>& b, out_t<dtype> out = none::out<dtype>) const {
+            const shape_t a_shape = a.shape(), b_shape = b.shape();
+            size_t a_first = 0, b_first = 0;
+
+            while (a_first < a_shape.ndim && a_shape[a_first] == 1) {
+                a_first++;
+            }
+            while (b_first < b_shape.ndim && b_shape[b_first] == 1) {
+                b_first++;
+            }
+            const size_t a_ndim = a_shape.ndim - a_first, b_ndim = b_shape.ndim - b_first;
 
-            for (ll_t i = 0; i < col; i++) {
-                buf[i] = func(lhs[{slice_t(), i}], rhs[{slice_t(), i}], std::forward<Args>(args)...);
+            if (a_ndim + b_ndim > shape_t::max_ndim) {
+                throw std::invalid_argument("maximum supported dimension for an array is 8");
             }
-            res = array<dtype>(std::move(buf), col);
-        } else if (axis == 1 || axis == -1) {
-            if (out && out->shape() != shape_t(row, 1)) {
+            size_t dims[shape_t::max_ndim];
+            std::copy_n(a_shape.dims + a_first, a_ndim, dims);
+            std::fill_n(dims + a_ndim, b_ndim, 1);
+            return (*this)(a.reshape(shape_t(dims, a_ndim + b_ndim)), b.reshape(shape_t(b_shape.dims + b_first, b_ndim)), out);
+        }
+
+        // Reduces the segments [indices[i], indices[i + 1]) of `axis`, the last one running to the end, into entry i along that axis; an
+        // index not below the next one selects the single element at it, as in NumPy. Segments are reduced in parallel.
+        template <typename T, typename dtype = T>
+        array<dtype> reduceat(const array<T>& a, const array<ll_t>& indices, const int8_t axis = -1, out_t<dtype> out = none::out<dtype>) const {
+            using unit_step_t = std::integral_constant<ll_t, 1>;
+            const shape_t shape = a.shape();
+            const size_t ax = detail::normalize_axis(axis, shape.ndim), n = shape[ax], count = indices.size();
+            const array<ll_t> starts = indices.copy();
+            const ll_t* start_ptr = starts.data();
+            shape_t res_shape = shape, lane_shape = shape;
+            res_shape[ax] = count;
+            lane_shape[ax] = 1;
+
+            if (out && out->shape() != res_shape) {
                 throw std::invalid_argument("Shape mis-match with out and expected out-put");
             }
-            buf = out ? buffer(*out.ptr) : buffer_t<dtype>(row);
+            for (size_t i = 0; i < count; i++) {
+                if (start_ptr[i] < 0 || start_ptr[i] >= ll_t(n)) {
+                    throw std::invalid_argument("index " + std::to_string(start_ptr[i]) + " out-of-bounds in " + name + ".reduceat [0, " +
+                                                std::to_string(n) + ")");
+                }
+            }
+            NUMCPP_PROFILE_SCOPE(ufunc_reduce, shape.size(), shape.size() * sizeof(T), res_shape.size() * sizeof(dtype));
+            detail::fp_scope_t fp_errors(!std::is_same_v<dtype, bool>);
+            array<dtype> result = out ? array<dtype>() : array<dtype>(buffer_t<dtype>(res_shape.size()), res_shape);
+            array<dtype>& target = out ? *out : result;
+            const T* src = a.data();
+            const strides_t src_strides = strides(a);
+            dtype* res = target.data();
+            strides_t res_strides = strides(target);
+            const ll_t res_step = res_strides[ax];
+            res_strides[ax] = 0;
+            const auto reducer = detail::reducer_t{typed<dtype>(), neutral<dtype>(), neutral<dtype>()};
+            const size_t grain = detail::parallel_reduce_bytes / 4 / (shape.size() / std::max<size_t>(count, 1) * sizeof(T) + 1) + 1;
+
+            detail::parallel_for(count, grain, [&](const size_t begin, const size_t end) {
+                for (size_t i = begin; i < end; i++) {
+                    const ll_t start = start_ptr[i], next = i + 1 < count ? start_ptr[i + 1] : ll_t(n), stop = start < next ? next : start + 1;
+                    const T* segment = src + start * src_strides[ax];
+                    dtype* row = res + ll_t(i) * res_step;
+                    shape_t part = shape;
+                    part[ax] = size_t(stop - start);
 
-            for (size_t i = 0; i < row; i++) {
-                buf[i] = func(lhs[i], rhs[i], std::forward<Args>(args)...);
+                    if (!associative) {
+                        detail::fold(part, segment, src_strides, row, res_strides, ax, static_cast<const dtype*>(nullptr), reducer.op);
+                    } else if (lane_shape.size() == 1 && src_strides[ax] == 1) {
+                        *row = detail::reduce_run<false>(segment, unit_step_t(), static_cast<const bool*>(nullptr), unit_step_t(), part[ax], reducer);
+                    } else {
+                        detail::strided_loop<1>(lane_shape, {res_strides}, [&](const auto& pos, const size_t len, const auto& step) {
+                            for (size_t k = 0; k < len; k++) {
+                                row[pos[0] + ll_t(k) * step[0]] = reducer.initial;
+                            }
+                        });
+                        detail::reduce(part, segment, src_strides, row, res_strides, static_cast<const bool*>(nullptr), strides_t(), reducer);
+                    }
+                }
+            });
+            fp_errors.report();
+            if (out) {
+                return *out;
             }
-            res = array<dtype>(std::move(buf), {row, 1});
-        } else {
-            throw std::invalid_argument("other axes are not suppoerted");
+            return result;
+        }
+
+        // a[indices] = op(a[indices], values) in place and unbuffered, so that a repeated index applies op once per occurrence.
+        template <typename T, typename U>
+        void at(array<T>& a, const array<ll_t>& indices, const array<U>& values, const int8_t axis = none::axis) const {
+            ufunc_scatter(a, indices, values, axis, typed<T>(), associative);
         }
-        return keepdims ? res[slice_t()] : res;
+        template <typename T>
+        void at(array<T>& a, const array<ll_t>& indices, const std::type_identity_t<T> value, const int8_t axis = none::axis) const {
+            at(a, indices, array<T>(value), axis);
+        }
+    };
+
+    // Binary ufuncs with reductions, as np.add.reduce, np.maximum.reduceat or np.add.at. subtract and divide are not associative.
+    namespace ufuncs {
+        inline constexpr binary_ufunc_t add{std::plus<>(), identity_t::zero, true, "add"};
+        inline constexpr binary_ufunc_t subtract{std::minus<>(), identity_t::none, false, "subtract"};
+        inline constexpr binary_ufunc_t multiply{std::multiplies<>(), identity_t::one, true, "multiply"};
+        inline constexpr binary_ufunc_t divide{detail::divides(), identity_t::none, false, "divide"};
+        inline constexpr binary_ufunc_t maximum{detail::maximum(), identity_t::lowest, true, "maximum"};
+        inline constexpr binary_ufunc_t minimum{detail::minimum(), identity_t::highest, true, "minimum"};
+        inline constexpr binary_ufunc_t bitwise_and{std::bit_and<>(), identity_t::all_ones, true, "bitwise_and"};
+        inline constexpr binary_ufunc_t bitwise_or{std::bit_or<>(), identity_t::zero, true, "bitwise_or"};
+        inline constexpr binary_ufunc_t bitwise_xor{std::bit_xor<>(), identity_t::zero, true, "bitwise_xor"};
+    } // namespace ufuncs
+
+    namespace detail {
+        template <typename T>
+        struct operand_value {
+            using type = T;
+        };
+        template <typename T>
+        struct operand_value<array<T>> {
+            using type = T;
+        };
+        template <typename T> using operand_value_t = typename operand_value<std::remove_cvref_t<T>>::type;
+        template <typename T> inline constexpr bool is_array_v = !std::is_same_v<operand_value_t<T>, std::remove_cvref_t<T>>;
+    } // namespace detail
+
+    // A scalar function lifted to arrays, as returned by vectorize. Called with at least one array it broadcasts its arguments and runs
+    // ufunc_nary, the function inlined into the loop; called with scalars only it calls the function, so vectorized functions compose
+    // into one lambda that is then lifted as a whole, e.g. vectorize([=](auto x) { return f(g(x)); }) for vectorized f and g.
+    template <typename F, typename dtype = void>
+    struct vectorized_t {
+        F func;
+        bool parallel = false;
+
+        template <typename... Args>
+        requires(sizeof...(Args) > 0 && (!detail::is_array_v<Args> && ...))
+        constexpr auto operator()(const Args&... args) const {
+            if constexpr (std::is_void_v<dtype>) {
+                return func(args...);
+            } else {
+                return static_cast<dtype>(func(args...));
+            }
+        }
+
+        template <typename... Args>
+        requires((detail::is_array_v<Args> || ...))
+        auto operator()(const Args&... args) const {
+            using res_t = std::conditional_t<std::is_void_v<dtype>,
+                                             std::decay_t<std::invoke_result_t<const F&, const detail::operand_value_t<Args>&...>>, dtype>;
+            return ufunc_nary(none::out<res_t>, parallel, func, detail::as_operand(args)...);
+        }
+    };
+
+    // Lifts a scalar function of any number of arguments to an elementwise function of arrays, as np.vectorize but compiled: the
+    // result type is that of func unless dtype is given, and `parallel` lets large calls run on several threads.
+    template <typename dtype = void, typename F>
+    constexpr vectorized_t<F, dtype> vectorize(F func, const bool parallel = false) {
+        return {std::move(func), parallel};
     }
 } // namespace numcpp
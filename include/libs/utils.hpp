@@ -3,26 +3,26 @@
 namespace numcpp {
 
     template <typename T>
-    array<T> fill(const shape_t& shape, const T& value) {
+    array<T> fill(const shape_t& shape, const T& value, const order_t order = order_t::C) {
         const size_t size = shape.size();
         buffer_t<T> buf(size);
         std::fill_n(buf.data(), size, value);
-        return array<T>(std::move(buf), shape);
+        return array<T>(std::move(buf), shape, order);
     }
 
     template <typename T = float64_t>
-    array<T> ones(const shape_t& shape) {
-        return fill(shape, T(1));
+    array<T> ones(const shape_t& shape, const order_t order = order_t::C) {
+        return fill(shape, T(1), order);
     }
 
     template <typename T = float64_t>
-    array<T> empty(const shape_t& shape) {
-        return array<T>(buffer_t<T>(shape.size()), shape);
+    array<T> empty(const shape_t& shape, const order_t order = order_t::C) {
+        return array<T>(buffer_t<T>(shape.size()), shape, order);
     }
 
     template <typename T = float64_t>
-    array<T> zeros(const shape_t& shape) {
-        return fill(shape, T());
+    array<T> zeros(const shape_t& shape, const order_t order = order_t::C) {
+        return fill(shape, T(), order);
     }
 
     template <typename T>
@@ -34,6 +34,10 @@ namespace numcpp {
         return arr.offset;
     }
     template <typename T>
+    constexpr strides_t strides(const array<T>& arr) noexcept {
+        return arr.strides;
+    }
+    template <typename T>
     constexpr const void* base(const array<T>& arr) noexcept {
         return arr.base;
     }
@@ -49,4 +53,66 @@ namespace numcpp {
     constexpr bool is_assignable(const array<T>& arr) noexcept {
         return arr.is_assignable;
     }
+
+    namespace detail {
+        // Byte addresses [first, last) spanned by the elements of `arr`, empty for an empty array.
+        template <typename T>
+        std::pair<uintptr_t, uintptr_t> memory_bounds(const array<T>& arr) noexcept {
+            const shape_t shape = arr.shape();
+            const strides_t arr_strides = strides(arr);
+            uintptr_t first = reinterpret_cast<uintptr_t>(arr.data()), last = first + sizeof(T);
+
+            if (shape.size() == 0) {
+                return {first, first};
+            }
+            for (size_t d = 0; d < shape.ndim; d++) {
+                const ll_t span = ll_t(shape[d] - 1) * arr_strides[d] * ll_t(sizeof(T));
+                span < 0 ? first -= uintptr_t(-span) : last += uintptr_t(span);
+            }
+            return {first, last};
+        }
+
+        template <typename T>
+        std::vector<uintptr_t> element_addresses(const array<T>& arr) {
+            std::vector<uintptr_t> res;
+            res.reserve(arr.size());
+            const uintptr_t first = reinterpret_cast<uintptr_t>(arr.data());
+            strided_loop<1>(arr.shape(), {strides(arr)}, [&](const auto& pos, const size_t n, const auto& step) {
+                for (size_t k = 0; k < n; k++) {
+                    res.push_back(first + uintptr_t((pos[0] + ll_t(k) * step[0]) * ll_t(sizeof(T))));
+                }
+            });
+            return res;
+        }
+    } // namespace detail
+
+    // Cheap test on the address ranges of both arrays: false means they are certainly independent.
+    template <typename T, typename U>
+    bool may_share_memory(const array<T>& a, const array<U>& b) noexcept {
+        const auto [a_first, a_last] = detail::memory_bounds(a);
+        const auto [b_first, b_last] = detail::memory_bounds(b);
+        return a_first < a_last && b_first < b_last && a_first < b_last && b_first < a_last;
+    }
+
+    // Exact test whether some element of `a` overlaps some element of `b`.
+    template <typename T, typename U>
+    bool shares_memory(const array<T>& a, const array<U>& b) {
+        if (!may_share_memory(a, b)) {
+            return false;
+        }
+        if (base(a) == &b || base(b) == &a || (is_contiguous(a.shape(), strides(a)) && is_contiguous(b.shape(), strides(b)))) {
+            return true;
+        }
+        std::vector<uintptr_t> starts = detail::element_addresses(a);
+        std::sort(starts.begin(), starts.end());
+
+        for (const uintptr_t start : detail::element_addresses(b)) {
+            const auto it = std::upper_bound(starts.begin(), starts.end(), start - sizeof(T));
+
+            if (it != starts.end() && *it < start + sizeof(U)) {
+                return true;
+            }
+        }
+        return false;
+    }
 } // namespace numcpp
@@ -1,16 +1,31 @@
 #pragma once
 #include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
 #include <complex>
+#include <cstring>
+#include <cstdint>
 #include <iomanip>
 #include <iostream>
+#include <limits>
 #include <memory>
 #include <numeric>
 #include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <tuple>
 #include <type_traits>
 #include <variant>
+#include <vector>
+#include "libs/profile.hpp"
+#include "libs/parallel.hpp"
+#include "libs/errstate.hpp"
 #include "libs/traits.hpp"
 #include "libs/types.hpp"
 #include "libs/detail.hpp"
+#include "libs/fastmath.hpp"
 
 namespace numcpp {
     class index_t;
@@ -19,8 +34,10 @@ namespace numcpp {
 } // namespace numcpp
 
 #include "core/array.hpp"
+#include "core/builder.hpp"
 #include "core/io.hpp"
 #include "core/operators.hpp"
+#include "core/bitmask.hpp"
 #include "libs/indexing.hpp"
 #include "libs/math.hpp"
 #include "libs/numeric.hpp"
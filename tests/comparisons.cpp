@@ -0,0 +1,59 @@
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <numcpp.hpp>
+#include <vector>
+
+namespace {
+    int failures = 0;
+
+    void check(const bool condition, const char* what) {
+        if (!condition) {
+            std::cerr << "FAILED: " << what << '\n';
+            failures++;
+        }
+    }
+} // namespace
+
+int main() {
+    using namespace numcpp;
+
+    const array<double> a = array<double>({1, 2, 3, 1, 2, 3}, {2, 3});
+    const array<double> row = array<double>({1, 2, 3}, {1, 3});
+    {
+        check(array_equal(array<int32_t>({1, 2, 3}), array<int32_t>({1, 2, 3})), "array_equal on integers");
+        check(!array_equal(array<int32_t>({1, 2, 3}), array<int32_t>({1, 2, 4})), "array_equal finds a mismatch");
+        check(array_equal(array<int32_t>({1, 2, 3}), array<double>({1, 2, 3})), "array_equal across dtypes");
+        check(!array_equal(a, row), "array_equal requires equal shapes");
+
+        const array<double> nan = {1, NAN};
+        check(!array_equal(nan, nan), "NaN is not equal to itself");
+        check(array_equal(nan, nan, true), "unless equal_nan");
+    }
+    {
+        check(array_equiv(a, row), "array_equiv broadcasts");
+        check(!array_equiv(a, array<double>({1, 2, 4}, {1, 3})), "array_equiv finds a mismatch");
+        check(!array_equiv(a, array<double>({1, 2}, {1, 2})), "array_equiv is false for shapes that do not broadcast");
+    }
+    {
+        check(allclose(a, row), "allclose broadcasts");
+        check(allclose(array<double>({1.0}), array<double>({1.0 + 1e-9})), "allclose within the default tolerances");
+        check(!allclose(array<double>({1.0}), array<double>({1.001})), "allclose outside the default tolerances");
+        check(allclose(array<double>({100.0}), array<double>({101.0}), 0.01, 0.0), "allclose with a relative tolerance");
+        check(allclose(array<int32_t>({1, 2}), array<int64_t>({1, 2})), "allclose on integers");
+        check(!allclose(array<double>({NAN}), array<double>({NAN})) && allclose(array<double>({NAN}), array<double>({NAN}), true),
+              "allclose and equal_nan");
+    }
+    {
+        // Mismatches in the first and in the last block of a long input.
+        constexpr size_t n = size_t(1) << 16;
+        const array<double> zeros(std::vector<double>(n, 0.0));
+        std::vector<double> first(n, 0.0), last(n, 0.0);
+        first[0] = 1;
+        last[n - 1] = 1;
+        check(array_equal(zeros, zeros.copy()), "long equal arrays");
+        check(!array_equal(zeros, array<double>(std::move(first))), "mismatch in the first element");
+        check(!array_equal(zeros, array<double>(std::move(last))), "mismatch in the last element");
+    }
+    return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,82 @@
+#include <cstdlib>
+#include <iostream>
+#include <numcpp.hpp>
+#include <utility>
+
+namespace {
+    int failures = 0;
+
+    void check(const bool condition, const char* what) {
+        if (!condition) {
+            std::cerr << "FAILED: " << what << '\n';
+            failures++;
+        }
+    }
+} // namespace
+
+int main() {
+    using namespace numcpp;
+    set_copy_on_write(true);
+
+    {
+        // A copy taken while a view is outstanding must not see writes through the view.
+        array<double> a = {1, 2, 3};
+        auto v = a[{0}];
+        array<double> c = a;
+        v = 100.0;
+        check(double(a[{0}]) == 100, "write through a view reaches its owner");
+        check(double(c[{0}]) == 1, "write through a view taken before the copy stays out of the copy");
+    }
+    {
+        array<double> a = {1, 2, 3};
+        array<double> c;
+        auto v = a[{slice_t(0, 2)}];
+        c = a;
+        v = 7.0;
+        check(double(c[{0}]) == 1 && double(c[{1}]) == 2, "assigned copy is independent of an earlier view");
+    }
+    {
+        array<complex128_t> z = {complex128_t(1, 2)};
+        auto r = z.real();
+        array<complex128_t> c = z;
+        r = 9.0;
+        check(z.data()[0].real == 9 && c.data()[0].real == 1, "real() view counts as a view");
+    }
+    {
+        // Views handed out by const functions are written through as well, so they detach their owner too.
+        array<double> a = {1, 2, 3, 4};
+        array<double> c = a;
+        auto r = c.reshape({2, 2});
+        r[{0, 0}] = 99.0;
+        check(double(a[{0}]) == 1 && double(c[{0}]) == 99, "write through reshape reaches only its owner");
+
+        array<double> d = a;
+        auto flat = d.ravel();
+        flat[{1}] = 7.0;
+        check(double(a[{1}]) == 2 && double(d[{1}]) == 7, "write through ravel reaches only its owner");
+
+        array<double> e = a;
+        auto v = std::as_const(e)[{slice_t(0, 2)}];
+        v = 5.0;
+        check(double(a[{0}]) == 1 && double(e[{0}]) == 5, "write through a const-indexed view reaches only its owner");
+    }
+    {
+        // Without views, copies share storage until the first write.
+        array<double> a = {1, 2, 3};
+        array<double> c = a;
+        check(shares_memory(a, c), "copies share storage");
+        c[{1}] = 5.0;
+        check(double(a[{1}]) == 2 && double(c[{1}]) == 5, "first write detaches the copy");
+    }
+    {
+        // Engines write into the caller's out, never into a copy of it.
+        array<double> a = {1, 2, 3};
+        array<double> out = {0.0, 0.0};
+        array<double> keep = out;
+        take(a, array<ll_t>({2, 0}, {1, 2}), none::axis, out_t<double>(out));
+        check(double(out[{0}]) == 3 && double(out[{1}]) == 1, "take writes into out");
+        check(double(keep[{0}]) == 0, "take leaves copies of out alone");
+    }
+    set_copy_on_write(false);
+    return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,56 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <numcpp.hpp>
+#include <vector>
+
+namespace {
+    int failures = 0;
+
+    void check(const bool condition, const char* what) {
+        if (!condition) {
+            std::cerr << "FAILED: " << what << '\n';
+            failures++;
+        }
+    }
+
+    bool same(const numcpp::array<double>& a, const numcpp::array<double>& b) {
+        return a.shape() == b.shape() && std::equal(a.data(), a.data() + a.size(), b.data());
+    }
+} // namespace
+
+int main() {
+    using namespace numcpp;
+
+    // 8 MiB, above the 4 MiB from which deterministic reductions merge fixed blocks, of terms whose rounded sum depends on the order.
+    constexpr size_t n = size_t(1) << 20;
+    std::vector<double> terms(n), counts(n);
+    for (size_t i = 0; i < n; i++) {
+        terms[i] = (i % 3 ? 1.0 : -1e3) / double(i + 1);
+        counts[i] = double(i);
+    }
+    const array<double> x(std::move(terms)), ramp(std::move(counts));
+    const array<double> grid = x.reshape({1024, n / 1024});
+
+    set_reduction_mode(reduction_mode_t::deterministic);
+    set_num_threads(1);
+    const double total = double(sum(x)), spread = double(var(x));
+    const array<double> columns = sum(grid, 0), rows = mean(grid, 1);
+    for (const size_t threads : {2, 3, 8}) {
+        set_num_threads(threads);
+        check(double(sum(x)) == total, "deterministic sum is bit-identical across thread counts");
+        check(double(var(x)) == spread, "deterministic var is bit-identical across thread counts");
+        check(same(sum(grid, 0), columns), "deterministic sum along axis 0 is bit-identical across thread counts");
+        check(same(mean(grid, 1), rows), "deterministic mean along axis 1 is bit-identical across thread counts");
+    }
+
+    set_reduction_mode(reduction_mode_t::fast);
+    for (const size_t threads : {1, 2, 8}) {
+        set_num_threads(threads);
+        check(double(sum(ramp)) == 549755289600.0, "fast sum of exact terms");
+        check(std::abs(double(sum(x)) - total) <= 1e-12 * std::abs(total), "fast sum agrees with deterministic to rounding");
+    }
+    set_num_threads(0);
+    return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
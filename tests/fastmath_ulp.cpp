@@ -0,0 +1,126 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <numcpp.hpp>
+#include <random>
+
+namespace {
+    int failures = 0;
+
+    void check(const bool condition, const char* what) {
+        if (!condition) {
+            std::cerr << "FAILED: " << what << '\n';
+            failures++;
+        }
+    }
+
+    // Distance from a long double reference in units of the last place of T at the reference, gradual below the normal range.
+    template <typename T>
+    long double ulps(const T value, const long double reference) {
+        if (std::isnan(reference) || std::isinf(T(reference))) {
+            return value == T(reference) || (std::isnan(value) && std::isnan(reference)) ? 0 : std::numeric_limits<long double>::infinity();
+        }
+        int exponent;
+        std::frexp(reference, &exponent);
+        exponent = std::max(exponent, std::numeric_limits<T>::min_exponent);
+        return std::abs(value - reference) / std::ldexp(1.0L, exponent - std::numeric_limits<T>::digits);
+    }
+
+    std::mt19937_64 engine(20240917);
+
+    // Uniform over [lo, hi], or log-uniform with a random sign for ranges over many decades.
+    double draw(const double lo, const double hi, const bool decades) {
+        if (!decades) {
+            return std::uniform_real_distribution<double>(lo, hi)(engine);
+        }
+        const double magnitude = std::exp(std::uniform_real_distribution<double>(std::log(lo), std::log(hi))(engine));
+        return engine() & 1 ? -magnitude : magnitude;
+    }
+
+    template <typename T, typename Fast, typename Exact>
+    long double max_ulps(Fast fast, Exact exact, const double lo, const double hi, const bool decades = false) {
+        long double res = 0;
+        for (int i = 0; i < 100000; i++) {
+            const T x = T(draw(lo, hi, decades));
+            res = std::max(res, ulps<T>(fast(x), exact(static_cast<long double>(x))));
+        }
+        return res;
+    }
+
+    // The bounds documented in fastmath.hpp, for float64 and float32 arguments.
+    template <typename T>
+    void check_bounds(const bool float64) {
+        using namespace numcpp::math;
+        const auto within = [&](const long double error, const double bound64, const double bound32) {
+            return error <= (float64 ? bound64 : bound32);
+        };
+        check(within(max_ulps<T>([](T x) { return fast::exp(x); }, [](long double x) { return std::exp(x); }, -740, 710), 1, 1), "exp");
+        check(within(max_ulps<T>([](T x) { return fast::exp(x); }, [](long double x) { return std::exp(x); }, -104, -87), 1, 1),
+              "exp into the subnormals");
+        check(within(max_ulps<T>([](T x) { return fast::log(std::abs(x)); }, [](long double x) { return std::log(std::abs(x)); }, 1e-44,
+                                 1e30, true),
+                     1, 1),
+              "log");
+        check(within(max_ulps<T>([](T x) { return fast::log(x); }, [](long double x) { return std::log(x); }, 0.5, 2), 1, 1),
+              "log around 1");
+        check(within(max_ulps<T>([](T x) { return fast::sin(x); }, [](long double x) { return std::sin(x); }, -51000, 51000), 1, 2.5),
+              "sin");
+        check(within(max_ulps<T>([](T x) { return fast::cos(x); }, [](long double x) { return std::cos(x); }, -51000, 51000), 1, 2.5),
+              "cos");
+        check(within(max_ulps<T>([](T x) { return fast::tan(x); }, [](long double x) { return std::tan(x); }, -51000, 51000), 2.5, 3.5),
+              "tan");
+        check(within(max_ulps<T>([](T x) { return fast::arctan(x); }, [](long double x) { return std::atan(x); }, 1e-10, 1e10, true), 2,
+                     0.5),
+              "arctan");
+        check(within(max_ulps<T>([](T x) { return fast::arcsin(x); }, [](long double x) { return std::asin(x); }, -1, 1), 3, 0.5),
+              "arcsin");
+        check(within(max_ulps<T>([](T x) { return fast::arccos(x); }, [](long double x) { return std::acos(x); }, -1, 1), 3.5, 0.5),
+              "arccos");
+        check(within(max_ulps<T>([](T x) { return fast::sinh(x); }, [](long double x) { return std::sinh(x); }, -80, 80), 3, 0.5), "sinh");
+        check(within(max_ulps<T>([](T x) { return fast::cosh(x); }, [](long double x) { return std::cosh(x); }, -80, 80), 3, 0.5), "cosh");
+        check(within(max_ulps<T>([](T x) { return fast::tanh(x); }, [](long double x) { return std::tanh(x); }, -20, 20), 3, 0.5), "tanh");
+        check(within(max_ulps<T>([](T x) { return fast::arcsinh(x); }, [](long double x) { return std::asinh(x); }, 1e-10, 1e30, true), 3,
+                     0.5),
+              "arcsinh");
+        check(within(max_ulps<T>([](T x) { return fast::arccosh(std::abs(x)); }, [](long double x) { return std::acosh(std::abs(x)); }, 1,
+                                 1e30, true),
+                     3.5, 0.5),
+              "arccosh");
+        check(within(max_ulps<T>([](T x) { return fast::arctanh(x); }, [](long double x) { return std::atanh(x); }, -1, 1), 3.5, 0.5),
+              "arctanh");
+
+        long double arctan2 = 0, power = 0;
+        for (int i = 0; i < 100000; i++) {
+            const T y = T(draw(-10, 10, false)), x = T(draw(-10, 10, false));
+            arctan2 = std::max(arctan2, ulps<T>(fast::arctan2(y, x), std::atan2(static_cast<long double>(y), static_cast<long double>(x))));
+
+            // Negative bases take integral exponents, for which the result is real.
+            const T base = T(draw(1e-3, 1e3, true)), exponent = T(base < 0 ? std::round(draw(-8, 8, false)) : draw(-8, 8, false));
+            const long double scale = std::max(1.0L, std::abs(exponent * std::log(std::abs(static_cast<long double>(base)))));
+            power = std::max(power, ulps<T>(fast::power(base, exponent), std::pow(static_cast<long double>(base), exponent)) / scale);
+        }
+        check(within(arctan2, 3, 0.5), "arctan2");
+        check(within(power, 2.5, 0.5), "power within 2.5 * |y * ln(x)| ulp");
+    }
+} // namespace
+
+int main() {
+    using namespace numcpp::math;
+    check_bounds<double>(true);
+    check_bounds<float>(false);
+
+    {
+        constexpr double inf = std::numeric_limits<double>::infinity();
+        const auto near = [](const double a, const double b) { return std::abs(a - b) <= 1e-14 * std::abs(b); };
+        check(near(fast::power(-2.0, 3.0), -8) && near(fast::power(-2.0, 2.0), 4) && near(fast::power(-2.0, -1.0), -0.5), "negative base, integer y");
+        check(std::isnan(fast::power(-8.0, 1.0 / 3)), "negative finite base, non-integer y");
+        check(fast::power(-1.0, 0x1p52 + 1) == -1 && fast::power(-1.0, 0x1p53) == 1, "parity of large y");
+        check(fast::power(-1.0, inf) == 1 && fast::power(-1.0, -inf) == 1 && fast::power(-0.5, -inf) == inf, "negative base, infinite y");
+        check(fast::power(-0.0, -1.0) == -inf && fast::power(-0.0, -2.0) == inf && std::signbit(fast::power(-0.0, 3.0)), "negative zero");
+        check(fast::power(-inf, 3.0) == -inf && fast::power(-inf, 0.5) == inf && fast::power(-inf, -3.0) == 0, "negative infinite base");
+        check(near(fast::power(-2.0f, 3.0f), -8) && std::isnan(fast::power(-2.0f, 0.5f)), "float32 negative base");
+    }
+    return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
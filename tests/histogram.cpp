@@ -0,0 +1,83 @@
+#include <algorithm>
+#include <cstdlib>
+#include <initializer_list>
+#include <iostream>
+#include <numcpp.hpp>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+    int failures = 0;
+
+    void check(const bool condition, const char* what) {
+        if (!condition) {
+            std::cerr << "FAILED: " << what << '\n';
+            failures++;
+        }
+    }
+
+    template <typename T>
+    bool equals(const numcpp::array<T>& a, const std::initializer_list<T> expected) {
+        const numcpp::array<T> flat = a.copy();
+        return flat.size() == expected.size() && std::equal(expected.begin(), expected.end(), flat.data());
+    }
+} // namespace
+
+int main() {
+    using namespace numcpp;
+
+    {
+        const array<int64_t> x = {0, 1, 1, 3};
+        check(equals(bincount(x), {int64_t(1), int64_t(2), int64_t(0), int64_t(1)}), "bincount up to the largest value");
+        check(bincount(x, 6).size() == 6 && bincount(x, 6).data()[5] == 0, "bincount pads to minlength");
+        check(equals(bincount(x, array<double>({0.5, 1, 1, 2})), {0.5, 2.0, 0.0, 2.0}), "bincount with weights");
+
+        bool thrown = false;
+        try {
+            bincount(array<int64_t>({1, -1}));
+        } catch (const std::invalid_argument&) {
+            thrown = true;
+        }
+        check(thrown, "bincount rejects negative values");
+    }
+    {
+        // Samples on interior edges go to the bin on their right, hi to the last bin, samples outside [lo, hi] nowhere.
+        const array<double> a = {-0.5, 0, 0.25, 0.5, 0.75, 1, 1.5};
+        const auto [counts, edges] = histogram(a, 4, 0.0, 1.0);
+        check(equals(counts, {int64_t(1), int64_t(1), int64_t(1), int64_t(2)}), "uniform bins at their edges");
+        check(equals(edges, {0.0, 0.25, 0.5, 0.75, 1.0}), "uniform bin edges");
+
+        // 0.3 lies below the fourth edge of ten bins over [0, 1], which rounds to 0.30000000000000004.
+        check(histogram(array<double>({0.3}), 10, 0.0, 1.0).first.data()[2] == 1, "a sample just below a rounded edge");
+
+        const auto [same, widened] = histogram(array<double>({5, 5, 5}), 2);
+        check(equals(same, {int64_t(0), int64_t(3)}) && equals(widened, {4.5, 5.0, 5.5}), "equal samples widen the range by a half");
+    }
+    {
+        const array<double> edges = {0, 1, 10};
+        const array<double> a = {-0.1, 0, 0.5, 1, 9.99, 10, 10.5};
+        check(equals(histogram(a, edges), {int64_t(2), int64_t(3)}), "explicit edges, the last bin closed");
+        check(equals(histogram(array<int32_t>({0, 1, 10}), edges), {int64_t(1), int64_t(2)}), "explicit edges for integer samples");
+
+        const array<int64_t> grid = histogram2d(array<double>({0, 0.5, 1, 1}), array<double>({1, 0, 0, 1}), array<double>({0, 0.5, 1}),
+                                                array<double>({0, 0.5, 1}));
+        check(equals(grid, {int64_t(0), int64_t(1), int64_t(2), int64_t(1)}), "histogram2d with edges");
+    }
+    {
+        // Enough samples for per-thread histograms merged at the end.
+        constexpr size_t n = size_t(1) << 18;
+        std::vector<int64_t> values(n);
+        for (size_t i = 0; i < n; i++) {
+            values[i] = int64_t(i % 4);
+        }
+        const array<int64_t> x(std::move(values));
+        constexpr int64_t quarter = int64_t(n / 4);
+        for (const size_t threads : {1, 4}) {
+            set_num_threads(threads);
+            check(equals(bincount(x), {quarter, quarter, quarter, quarter}), "bincount merged across threads");
+            check(equals(histogram(x, 4, 0.0, 4.0).first, {quarter, quarter, quarter, quarter}), "histogram merged across threads");
+        }
+        set_num_threads(0);
+    }
+    return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
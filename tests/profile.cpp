@@ -0,0 +1,46 @@
+#include <cstdlib>
+#include <iostream>
+#include <numcpp.hpp>
+
+namespace {
+    int failures = 0;
+
+    void check(const bool condition, const char* what) {
+        if (!condition) {
+            std::cerr << "FAILED: " << what << '\n';
+            failures++;
+        }
+    }
+} // namespace
+
+int main() {
+    using namespace numcpp;
+    profile::enable();
+    set_num_threads(4);
+
+    {
+        // Each of the four chunks allocates once, three of them on worker threads.
+        {
+            const profile::region_t region("chunks");
+            detail::parallel_for(4, 1, [](size_t, size_t) { const array<double> scratch = {1, 2, 3}; });
+        }
+        const profile::report_t report = profile::report();
+        check(report.regions.at("chunks").calls == 1, "region counted once");
+        check(report.regions.at("chunks").temporaries == 4, "region counts the allocations of the workers it joins");
+        check(report.allocations == 4, "report counts every thread");
+    }
+    {
+        profile::reset();
+        const array<double> a = {1, 2, 3, 4};
+        {
+            const profile::region_t region("add");
+            const array<double> b = a + a;
+        }
+        const profile::report_t report = profile::report();
+        check(report[profile::kernel::binary_opr_broadcast].calls == 1, "kernel call counted");
+        check(report.regions.at("add").elements == 4, "region counts the elements of its kernels");
+    }
+    set_num_threads(0);
+    profile::disable();
+    return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,61 @@
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <numcpp.hpp>
+
+namespace {
+    int failures = 0;
+
+    void check(const bool condition, const char* what) {
+        if (!condition) {
+            std::cerr << "FAILED: " << what << '\n';
+            failures++;
+        }
+    }
+} // namespace
+
+int main() {
+    using namespace numcpp;
+
+    const array<double> a = array<double>({1, 2, 3, 4, 5, 6}, {2, 3});
+    const array<bool> mask = array<bool>({true, true, false, true, false, true}, {2, 3});
+    {
+        check(double(sum(a)) == 21, "sum of all elements");
+        const array<double> columns = sum(a, 0);
+        check(columns.size() == 3 && columns.data()[0] == 5 && columns.data()[1] == 7 && columns.data()[2] == 9, "sum along axis 0");
+        const array<double> rows = sum(a, 1, true);
+        check(rows.shape() == shape_t(2, 1) && rows.data()[0] == 6 && rows.data()[1] == 15, "sum along axis 1 keeps dims");
+        check(double(sum(a, none::axis, false, 0.0, mask)) == 13, "sum over where");
+        check(double(sum(a, none::axis, false, 100.0)) == 121, "sum starts from initial");
+        check(double(prod(a)) == 720, "prod of all elements");
+    }
+    {
+        // 2^24 + 1 + 1 is not a float32, so only the float64 accumulator keeps the ones.
+        const array<float32_t> f = {16777216.0f, 1.0f, 1.0f};
+        check(double(sum<float64_t>(f)) == 16777218, "float32 input with a float64 accumulator");
+        const array<double> cancel = {1e16, 1, -1e16};
+        check(double(sum(cancel)) == 0, "pairwise sum loses the small term");
+        check(double(sum(cancel, none::axis, false, 0.0, none::where, summation_t::compensated)) == 1, "compensated sum keeps it");
+        const array<int32_t> big = {2147483647, 1};
+        check(int64_t(sum(big)) == 2147483648, "int32 sums accumulate in int64");
+    }
+    {
+        check(double(mean(a)) == 3.5, "mean of all elements");
+        const array<double> rows = mean(a, 1);
+        check(rows.data()[0] == 2 && rows.data()[1] == 5, "mean along axis 1");
+        const array<double> masked = mean(a, 1, false, mask);
+        check(masked.data()[0] == 1.5 && masked.data()[1] == 5, "mean over where counts selected elements only");
+        check(double(mean(array<int32_t>({1, 2}))) == 1.5, "mean of integers is float64");
+    }
+    {
+        const array<double> b = {2, 4, 4, 4, 5, 5, 7, 9};
+        check(double(var(b)) == 4 && double(stddev(b)) == 2, "population var and stddev");
+        check(std::abs(double(var(b, none::axis, 1)) - 32.0 / 7) < 1e-15, "sample var with ddof 1");
+        const array<double> rows = var(a, 1, size_t(1));
+        check(rows.data()[0] == 1 && rows.data()[1] == 1, "var along axis 1 with ddof 1");
+        const array<double> masked = var(a, 1, size_t(0), false, mask);
+        check(masked.data()[0] == 0.25 && masked.data()[1] == 1, "var over where");
+        check(double(stddev<float64_t>(array<float32_t>({1.0f, 3.0f}))) == 1, "stddev with a float64 accumulator");
+    }
+    return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,68 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <initializer_list>
+#include <iostream>
+#include <numcpp.hpp>
+#include <vector>
+
+namespace {
+    int failures = 0;
+
+    void check(const bool condition, const char* what) {
+        if (!condition) {
+            std::cerr << "FAILED: " << what << '\n';
+            failures++;
+        }
+    }
+
+    template <typename T>
+    bool equals(const numcpp::array<T>& a, const std::initializer_list<T> expected) {
+        const numcpp::array<T> flat = a.copy();
+        return flat.size() == expected.size() && std::equal(expected.begin(), expected.end(), flat.data());
+    }
+} // namespace
+
+int main() {
+    using namespace numcpp;
+
+    const array<double> a = array<double>({1, 2, 3, 4, 5, 6}, {2, 3});
+    {
+        check(equals(cumsum(a), {1.0, 3.0, 6.0, 10.0, 15.0, 21.0}), "cumsum of the flattened array");
+        check(equals(cumsum(a, 0), {1.0, 2.0, 3.0, 5.0, 7.0, 9.0}), "cumsum along axis 0");
+        check(equals(cumsum(a, 1), {1.0, 3.0, 6.0, 4.0, 9.0, 15.0}), "cumsum along axis 1");
+        check(equals(cumprod(array<int32_t>({1, 2, 3, 4})), {int64_t(1), int64_t(2), int64_t(6), int64_t(24)}), "cumprod of int32 in int64");
+        check(equals(cummax(array<double>({1, 3, 2, 5, 4})), {1.0, 3.0, 3.0, 5.0, 5.0}), "cummax");
+
+        const array<double> nan = cummax(array<double>({1, NAN, 3}));
+        check(nan.data()[0] == 1 && std::isnan(nan.data()[1]) && std::isnan(nan.data()[2]), "cummax propagates NaN");
+        check(equals(accumulate(array<int64_t>({6, 5, 3}), std::bit_xor<int64_t>()), {int64_t(6), int64_t(3), int64_t(0)}),
+              "accumulate of a generic op");
+    }
+    {
+        // out may be the input itself, so that a scan runs in place.
+        array<double> b = {1, 2, 3, 4};
+        cumsum(b, none::axis, out_t<double>(b));
+        check(equals(b, {1.0, 3.0, 6.0, 10.0}), "cumsum in place through out");
+    }
+    {
+        // Long enough to be split into blocks whose carries are added in a second pass.
+        constexpr size_t n = size_t(1) << 20;
+        const array<double> ones(std::vector<double>(n, 1.0));
+        for (const size_t threads : {1, 4}) {
+            set_num_threads(threads);
+            const array<double> running = cumsum(ones);
+            check(running.data()[0] == 1 && running.data()[n / 2] == double(n / 2 + 1) && running.data()[n - 1] == double(n),
+                  "blocked cumsum carries across blocks");
+        }
+        set_num_threads(0);
+    }
+    {
+        // Segments [0, 4), [4] since 4 is not below 1, [1, 5) and [5, end), as in NumPy.
+        const array<double> x = {0, 1, 2, 3, 4, 5, 6, 7};
+        check(equals(ufuncs::add.reduceat(x, array<ll_t>({0, 4, 1, 5})), {6.0, 4.0, 10.0, 18.0}), "add.reduceat");
+        check(equals(ufuncs::maximum.reduceat(a, array<ll_t>({0, 1}), 1), {1.0, 3.0, 4.0, 6.0}), "maximum.reduceat along axis 1");
+        check(equals(ufuncs::add.reduceat(a, array<ll_t>({0}), 0), {5.0, 7.0, 9.0}), "add.reduceat along axis 0");
+    }
+    return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,90 @@
+#include <algorithm>
+#include <cstdlib>
+#include <initializer_list>
+#include <iostream>
+#include <numcpp.hpp>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+    int failures = 0;
+
+    void check(const bool condition, const char* what) {
+        if (!condition) {
+            std::cerr << "FAILED: " << what << '\n';
+            failures++;
+        }
+    }
+
+    template <typename T>
+    bool equals(const numcpp::array<T>& a, const std::initializer_list<T> expected) {
+        const numcpp::array<T> flat = a.copy();
+        return flat.size() == expected.size() && std::equal(expected.begin(), expected.end(), flat.data());
+    }
+} // namespace
+
+int main() {
+    using namespace numcpp;
+
+    const array<double> a = array<double>({1, 2, 3, 4, 5, 6}, {2, 3});
+    {
+        check(equals(take(a, array<ll_t>({5, 0, -1})), {6.0, 1.0, 6.0}), "take from the flattened array, negative from the end");
+        check(equals(take(a, array<ll_t>({2, 0}), 1), {3.0, 1.0, 6.0, 4.0}), "take along axis 1");
+        check(equals(take(a, array<ll_t>({1}), 0), {4.0, 5.0, 6.0}), "take along axis 0");
+
+        bool thrown = false;
+        try {
+            take(a, array<ll_t>({6}));
+        } catch (const std::out_of_range&) {
+            thrown = true;
+        }
+        check(thrown, "take rejects an index out of bounds");
+
+        const array<ll_t> order = array<ll_t>({2, 0, 1, 1, 2, 0}, {2, 3});
+        check(equals(take_along_axis(a, order, 1), {3.0, 1.0, 2.0, 5.0, 6.0, 4.0}), "take_along_axis");
+    }
+    {
+        array<double> b = {0, 0, 0, 0};
+        put(b, array<ll_t>({1, 3}), array<double>({5, 6}));
+        check(equals(b, {0.0, 5.0, 0.0, 6.0}), "put");
+        put(b, array<ll_t>({0, 0}), array<double>({7, 8}));
+        check(b.data()[0] == 8, "put: the last write to a repeated index wins");
+        put(b, array<ll_t>({1, 2, 3}), array<double>({9}));
+        check(equals(b, {8.0, 9.0, 9.0, 9.0}), "put repeats short values");
+    }
+    {
+        array<double> b = {0, 0, 0, 0};
+        ufuncs::add.at(b, array<ll_t>({0, 0, 2}), array<double>({1, 2, 3}));
+        check(equals(b, {3.0, 0.0, 3.0, 0.0}), "add.at adds once per repeat of an index");
+        ufuncs::multiply.at(b, array<ll_t>({0, 0}), 2.0);
+        check(b.data()[0] == 12, "multiply.at with a scalar");
+        ufuncs::subtract.at(b, array<ll_t>({2, 2}), array<double>({1, 1}));
+        check(b.data()[2] == 1, "subtract.at in index order");
+
+        array<double> m = array<double>({0, 0, 0, 0, 0, 0}, {3, 2});
+        scatter_add(m, array<ll_t>({0, 2, 0}), 1.0, 0);
+        check(equals(m, {2.0, 2.0, 0.0, 0.0, 1.0, 1.0}), "scatter_add of slabs along axis 0");
+    }
+    {
+        // Enough updates for the parallel paths: atomics for unsorted indices and runs of equal ones for sorted indices.
+        constexpr size_t n = size_t(1) << 18;
+        std::vector<ll_t> unsorted(n), sorted(n);
+        for (size_t i = 0; i < n; i++) {
+            unsorted[i] = ll_t(i % 4);
+            sorted[i] = ll_t(i * 4 / n);
+        }
+        const array<ll_t> spread(std::move(unsorted)), runs(std::move(sorted));
+        for (const size_t threads : {1, 4}) {
+            set_num_threads(threads);
+            array<int64_t> counts = {0, 0, 0, 0};
+            array<double> totals = {0, 0, 0, 0};
+            scatter_add(counts, spread, int64_t(1));
+            scatter_add(totals, runs, 1.0);
+            constexpr int64_t quarter = int64_t(n / 4);
+            check(equals(counts, {quarter, quarter, quarter, quarter}), "scatter_add with unsorted repeated indices");
+            check(equals(totals, {double(quarter), double(quarter), double(quarter), double(quarter)}), "scatter_add with sorted indices");
+        }
+        set_num_threads(0);
+    }
+    return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}